@@ -0,0 +1,157 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Times the trivial accessors and operator aliases in tight loops over opinions fitting in cache.
+// Build it once as is, once with -DSUBJ_INLINE_ACCESSORS=ON and once with -DSUBJ_ENABLE_IPO=ON to
+// compare out-of-line calls into the library with inlined ones.
+
+#include <subj/subj.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename Function>
+double nanosecondsPerElement(size_t elements, size_t iterations, const Function& function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    function();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(elements * iterations);
+}
+
+void report(const char* name, double nanoseconds)
+{
+  std::cout << name << ": " << nanoseconds << " ns" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  size_t count      = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000;
+  size_t iterations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  std::vector<subj::BinomialOpinion> opinions;
+  opinions.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    double b = uniform(generator);
+    double d = (1.0 - b) * uniform(generator);
+    opinions.emplace_back(b, d, 1.0 - b - d, uniform(generator));
+    opinions.back().projectionMat();
+  }
+
+#ifdef SUBJ_INLINE_ACCESSORS
+  std::cout << "inline accessors";
+#else
+  std::cout << "out-of-line accessors";
+#endif
+  std::cout << ", " << count << " binomial opinions" << std::endl;
+
+  double checksum = 0.0;
+  report("u()", nanosecondsPerElement(count, iterations, [&]() {
+           double sum = 0.0;
+           for (const subj::BinomialOpinion& o : opinions)
+           {
+             sum += o.u();
+           }
+           checksum += sum;
+         }));
+  report("b() + d()", nanosecondsPerElement(count, iterations, [&]() {
+           double sum = 0.0;
+           for (const subj::BinomialOpinion& o : opinions)
+           {
+             sum += o.b() + o.d();
+           }
+           checksum += sum;
+         }));
+  report("dim()", nanosecondsPerElement(count, iterations, [&]() {
+           Eigen::Index sum = 0;
+           for (const subj::BinomialOpinion& o : opinions)
+           {
+             sum += o.dim();
+           }
+           checksum += static_cast<double>(sum);
+         }));
+  report("p()", nanosecondsPerElement(count, iterations, [&]() {
+           double sum = 0.0;
+           for (const subj::BinomialOpinion& o : opinions)
+           {
+             sum += o.p();
+           }
+           checksum += sum;
+         }));
+  report("cc()", nanosecondsPerElement(count - 1, iterations, [&]() {
+           double sum = 0.0;
+           for (size_t i = 1; i < count; ++i)
+           {
+             sum += subj::cc(opinions[i - 1], opinions[i]);
+           }
+           checksum += sum;
+         }));
+  report("pd()", nanosecondsPerElement(count - 1, iterations, [&]() {
+           double sum = 0.0;
+           for (size_t i = 1; i < count; ++i)
+           {
+             sum += subj::pd(opinions[i - 1], opinions[i]);
+           }
+           checksum += sum;
+         }));
+  report("td()", nanosecondsPerElement(count, iterations / 10 + 1, [&]() {
+           double sum = 0.0;
+           for (const subj::BinomialOpinion& o : opinions)
+           {
+             sum += subj::td(o, 0.9).u();
+           }
+           checksum += sum;
+         }));
+
+  std::cout << "(checksum " << checksum << ")" << std::endl;
+
+  return 0;
+}
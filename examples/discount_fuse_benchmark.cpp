@@ -0,0 +1,179 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+// Compares discountAndFuse() with trust discounting every report followed by a fusion, for single
+// groups of reports and for batches of segments.
+
+#include <subj/subj.h>
+
+#include <Eigen/Dense>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename Function>
+double nanosecondsPerCall(size_t calls, const Function& function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < calls; ++i)
+  {
+    function();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(calls);
+}
+
+subj::MultinomialOpinion randomOpinion(std::mt19937& generator, Eigen::Index dim)
+{
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  Eigen::VectorXd belief(dim);
+  Eigen::VectorXd base_rate(dim);
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i)    = uniform(generator);
+    base_rate(i) = uniform(generator);
+  }
+  double uncertainty = uniform(generator);
+  belief *= (1.0 - uncertainty) / belief.sum();
+  base_rate /= base_rate.sum();
+  return subj::MultinomialOpinion(belief, uncertainty, base_rate);
+}
+
+void report(const char* name, double composed, double fused)
+{
+  std::cout << name << ": composed " << composed << " ns, fused " << fused << " ns, speedup "
+            << composed / fused << "x" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  size_t reports    = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+  Eigen::Index dim  = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 8;
+  size_t segments   = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10000;
+  size_t iterations = 20000;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  std::vector<subj::MultinomialOpinion> opinions;
+  std::vector<double> trust;
+  for (size_t i = 0; i < reports; ++i)
+  {
+    opinions.push_back(randomOpinion(generator, dim));
+    trust.push_back(uniform(generator));
+  }
+
+  std::cout << reports << " reports of dimension " << dim << std::endl;
+
+  double checksum = 0.0;
+  double composed = nanosecondsPerCall(iterations, [&]() {
+    std::vector<subj::MultinomialOpinion> discounted;
+    discounted.reserve(opinions.size());
+    for (size_t i = 0; i < opinions.size(); ++i)
+    {
+      discounted.push_back(subj::trustDiscounting(opinions[i], trust[i]));
+    }
+    checksum += subj::cbf(discounted).u();
+  });
+  double fused = nanosecondsPerCall(
+    iterations, [&]() { checksum += subj::discountAndFuse(opinions, trust).u(); });
+  report("discount + cbf", composed, fused);
+
+  composed = nanosecondsPerCall(iterations, [&]() {
+    std::vector<subj::MultinomialOpinion> discounted;
+    discounted.reserve(opinions.size());
+    for (size_t i = 0; i < opinions.size(); ++i)
+    {
+      discounted.push_back(subj::trustDiscounting(opinions[i], trust[i]));
+    }
+    checksum += subj::abf(discounted).u();
+  });
+  fused = nanosecondsPerCall(iterations, [&]() {
+    checksum += subj::discountAndFuse(opinions, trust, subj::FusionMode::AVERAGING).u();
+  });
+  report("discount + abf", composed, fused);
+
+  // Batches of segments with the same number of reports each.
+  Eigen::Index rows = static_cast<Eigen::Index>(segments * reports);
+  subj::BatchMatrix belief(rows, dim);
+  subj::BatchVector uncertainty(rows);
+  subj::BatchMatrix base_rate(rows, dim);
+  subj::BatchVector probability(rows);
+  for (Eigen::Index i = 0; i < rows; ++i)
+  {
+    subj::MultinomialOpinion opinion = randomOpinion(generator, dim);
+    belief.row(i)    = opinion.bMat().transpose();
+    uncertainty(i)   = opinion.u();
+    base_rate.row(i) = opinion.aMat().transpose();
+    probability(i)   = uniform(generator);
+  }
+  subj::SegmentOffsets offsets(segments + 1);
+  for (size_t s = 0; s <= segments; ++s)
+  {
+    offsets(s) = static_cast<Eigen::Index>(s * reports);
+  }
+
+  std::cout << segments << " segments of " << reports << " reports of dimension " << dim
+            << std::endl;
+
+  size_t batch_iterations = 10;
+
+  composed = nanosecondsPerCall(batch_iterations, [&]() {
+    subj::OpinionBatch discounted =
+      subj::batchTrustDiscounting(belief, uncertainty, base_rate, probability);
+    subj::OpinionBatch result = subj::batchCbf(
+      std::get<0>(discounted), std::get<1>(discounted), std::get<2>(discounted), offsets);
+    checksum += std::get<1>(result)(0);
+  });
+  fused = nanosecondsPerCall(batch_iterations, [&]() {
+    subj::OpinionBatch result = subj::batchDiscountAndFuse(
+      belief, uncertainty, base_rate, probability, offsets, subj::FusionMode::CUMULATIVE);
+    checksum += std::get<1>(result)(0);
+  });
+  report("batch discount + cbf", composed, fused);
+
+  std::cout << "(checksum " << checksum << ")" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,225 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Stress test of the executors behind the parallel operators: every task runs exactly once for
+// any task count, nested and concurrent calls finish, exceptions reach the caller, scopes bypass
+// the executor and every executor computes the same batch results. Exits with 1 on a failure,
+// run it under ThreadSanitizer after changing Executor.cpp. The pool size defaults to 4 threads.
+
+#include <subj/subj.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+size_t failures = 0;
+
+void check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    ++failures;
+    std::cout << "FAILED: " << what << std::endl;
+  }
+}
+
+// Forwards to another executor and counts the calls reaching it.
+class CountingExecutor : public subj::Executor
+{
+public:
+  explicit CountingExecutor(std::shared_ptr<subj::Executor> executor)
+    : m_executor(executor)
+    , m_calls(0)
+  {
+  }
+
+  size_t concurrency() const override { return m_executor->concurrency(); }
+
+  void run(size_t count, const std::function<void(size_t)>& task) override
+  {
+    ++m_calls;
+    m_executor->run(count, task);
+  }
+
+  size_t calls() const { return m_calls; }
+
+private:
+  std::shared_ptr<subj::Executor> m_executor;
+  std::atomic<size_t> m_calls;
+};
+
+void testCoverage(subj::Executor& executor)
+{
+  for (size_t count : {0, 1, 2, 5, 255, 256, 257, 1000, 100000})
+  {
+    std::vector<std::atomic<int> > calls(count);
+    for (std::atomic<int>& call : calls)
+    {
+      call = 0;
+    }
+    executor.run(count, [&](size_t i) { ++calls[i]; });
+    bool once = true;
+    for (const std::atomic<int>& call : calls)
+    {
+      once = once && call == 1;
+    }
+    check(once, "every task runs exactly once");
+  }
+}
+
+void testNesting(subj::Executor& executor)
+{
+  std::atomic<long> tasks(0);
+  executor.run(32, [&](size_t) {
+    executor.run(32, [&](size_t) { executor.run(16, [&](size_t) { ++tasks; }); });
+  });
+  check(tasks == 32 * 32 * 16, "nested calls three levels deep run all tasks");
+}
+
+void testConcurrentCallers(subj::Executor& executor)
+{
+  const int callers     = 16;
+  const int repetitions = 200;
+  std::atomic<long> tasks(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < callers; ++i)
+  {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < repetitions; ++j)
+      {
+        executor.run(3000, [&](size_t) { ++tasks; });
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  check(tasks == 3000L * callers * repetitions, "concurrent callers run all tasks");
+}
+
+void testException(subj::Executor& executor)
+{
+  bool caught = false;
+  try
+  {
+    executor.run(10000, [](size_t i) {
+      if (i == 5757)
+      {
+        throw std::out_of_range("task 5757");
+      }
+    });
+  }
+  catch (const std::out_of_range&)
+  {
+    caught = true;
+  }
+  check(caught, "the exception of a task is rethrown by run()");
+  testCoverage(executor);
+}
+
+bool equal(const subj::OpinionBatch& a, const subj::OpinionBatch& b)
+{
+  return std::get<0>(a) == std::get<0>(b) && std::get<1>(a) == std::get<1>(b);
+}
+
+void testOperators(const std::shared_ptr<subj::Executor>& pool)
+{
+  const Eigen::Index rows = 5000;
+  subj::BatchMatrix belief      = subj::BatchMatrix::Random(rows, 3).cwiseAbs() * 0.3;
+  subj::BatchVector uncertainty = subj::BatchVector::Constant(rows, 0.1);
+  subj::BatchMatrix base_rate   = subj::BatchMatrix::Constant(rows, 3, 1.0 / 3);
+  subj::SegmentOffsets offsets(51);
+  for (Eigen::Index i = 0; i <= 50; ++i)
+  {
+    offsets(i) = i * 100;
+  }
+  auto fuse = [&]() { return subj::batchCbf(belief, uncertainty, base_rate, offsets); };
+  auto deduce = [&]() {
+    return subj::batchDeduction(
+      belief, uncertainty, base_rate, belief.topRows(3), uncertainty.topRows(3));
+  };
+
+  auto counting = std::make_shared<CountingExecutor>(pool);
+  subj::setExecutor(counting);
+  subj::OpinionBatch fused   = fuse();
+  subj::OpinionBatch deduced = deduce();
+  check(counting->calls() > 0, "the operators use the installed executor");
+
+  size_t calls = counting->calls();
+  {
+    subj::ParallelScope serial(1);
+    check(equal(fuse(), fused) && equal(deduce(), deduced), "serial scope computes the same");
+    check(counting->calls() == calls, "serial scope does not involve the executor");
+    {
+      subj::ParallelScope two(2);
+      check(subj::ParallelScope::maxTasks() == 2, "scopes nest");
+      check(equal(fuse(), fused), "limited scope computes the same");
+    }
+    check(subj::ParallelScope::maxTasks() == 1, "scopes restore the outer limit");
+  }
+  check(subj::ParallelScope::maxTasks() == 0, "scopes restore no limit");
+
+  subj::setExecutor(std::make_shared<subj::SerialExecutor>());
+  check(equal(fuse(), fused) && equal(deduce(), deduced), "serial executor computes the same");
+  subj::setExecutor(std::make_shared<subj::WorkStealingExecutor>(2));
+  check(equal(fuse(), fused) && equal(deduce(), deduced), "two threads compute the same");
+  subj::setExecutor(nullptr);
+  check(subj::executor() == subj::defaultExecutor(), "null restores the default executor");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4;
+
+  auto pool = std::make_shared<subj::WorkStealingExecutor>(threads);
+  std::cout << "work-stealing executor with " << pool->concurrency() << " threads" << std::endl;
+  testCoverage(*pool);
+  testNesting(*pool);
+  testConcurrentCallers(*pool);
+  testException(*pool);
+  testOperators(pool);
+
+  std::cout << (failures == 0 ? "all checks passed" : "checks failed") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
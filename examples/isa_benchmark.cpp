@@ -0,0 +1,205 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Times the dispatched numeric kernels on every instruction set level the CPU supports. The level
+// selected at load time (see subj::isaLevel()) can be forced with SUBJ_ISA=baseline|avx2|avx512.
+
+#include <subj/DirichletPDF.h>
+#include <subj/Histogram.h>
+#include <subj/subj.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+namespace {
+
+template <typename Function>
+double nanosecondsPerElement(size_t elements, size_t iterations, const Function& function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    function();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(elements * iterations);
+}
+
+void report(const char* name, double nanoseconds)
+{
+  std::cout << "  " << name << ": " << nanoseconds << " ns" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  size_t count      = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+  size_t iterations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200;
+  Eigen::Index rows = static_cast<Eigen::Index>(count);
+  Eigen::Index dim  = 4;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  // Binomial opinions as (b, d, u, a) columns
+  Eigen::MatrixXd x(rows, 4), y(rows, 4), out(rows, 4);
+  subj::BatchVector discount(rows), measure(rows);
+  for (Eigen::Index i = 0; i < rows; ++i)
+  {
+    for (Eigen::MatrixXd* m : {&x, &y})
+    {
+      double b = uniform(generator);
+      double d = (1.0 - b) * uniform(generator);
+      m->row(i) << b, d, 1.0 - b - d, uniform(generator);
+    }
+    discount(i) = uniform(generator);
+  }
+
+  // Multinomial opinions of dimension dim and points on the simplex
+  subj::BatchMatrix belief(rows, dim), base_rate(rows, dim), points(rows, dim);
+  subj::BatchVector uncertainty(rows);
+  for (Eigen::Index i = 0; i < rows; ++i)
+  {
+    for (Eigen::Index j = 0; j < dim; ++j)
+    {
+      belief(i, j)    = uniform(generator) / dim;
+      base_rate(i, j) = 1.0 / dim;
+      points(i, j)    = uniform(generator) + 0.01;
+    }
+    uncertainty(i) = 1.0 - belief.row(i).sum();
+    points.row(i) /= points.row(i).sum();
+  }
+  subj::BatchMatrix belief_b = belief.rowwise().reverse();
+
+  Eigen::VectorXd values = Eigen::VectorXd::NullaryExpr(rows, [&]() { return uniform(generator); });
+
+  subj::DirichletPDF pdf;
+  pdf.updateEvidence(Eigen::VectorXd::LinSpaced(dim, 1.0, 10.0));
+  pdf.updateBaseRate(Eigen::VectorXd::Constant(dim, 1.0 / dim));
+
+  std::cout << count << " elements, selected level "
+            << subj::isaName(subj::isaLevel()) << std::endl;
+
+  double checksum = 0.0;
+  for (subj::IsaLevel level :
+       {subj::IsaLevel::BASELINE, subj::IsaLevel::AVX2, subj::IsaLevel::AVX512})
+  {
+    if (!subj::isaSupported(level))
+    {
+      continue;
+    }
+    subj::setIsaLevel(level);
+    std::cout << subj::isaName(level) << std::endl;
+
+    report("binomial averaging fusion", nanosecondsPerElement(count, iterations, [&]() {
+             subj::batchBinomialAveragingBeliefFusion(x.col(0),
+                                                      x.col(1),
+                                                      x.col(2),
+                                                      x.col(3),
+                                                      y.col(0),
+                                                      y.col(1),
+                                                      y.col(2),
+                                                      y.col(3),
+                                                      out.col(0),
+                                                      out.col(1),
+                                                      out.col(2),
+                                                      out.col(3));
+             checksum += out(0, 2);
+           }));
+    report("binomial cumulative fusion", nanosecondsPerElement(count, iterations, [&]() {
+             subj::batchBinomialAleatoryCumulativeBeliefFusion(x.col(0),
+                                                               x.col(1),
+                                                               x.col(2),
+                                                               x.col(3),
+                                                               y.col(0),
+                                                               y.col(1),
+                                                               y.col(2),
+                                                               y.col(3),
+                                                               out.col(0),
+                                                               out.col(1),
+                                                               out.col(2),
+                                                               out.col(3));
+             checksum += out(0, 2);
+           }));
+    report("binomial trust discounting", nanosecondsPerElement(count, iterations, [&]() {
+             subj::batchBinomialTrustDiscounting(x.col(0),
+                                                 x.col(1),
+                                                 x.col(2),
+                                                 x.col(3),
+                                                 discount,
+                                                 out.col(0),
+                                                 out.col(1),
+                                                 out.col(2),
+                                                 out.col(3));
+             checksum += out(0, 2);
+           }));
+    report("binomial degree of conflict", nanosecondsPerElement(count, iterations, [&]() {
+             subj::batchBinomialDegreeOfConflict(x.col(0),
+                                                 x.col(1),
+                                                 x.col(2),
+                                                 x.col(3),
+                                                 y.col(0),
+                                                 y.col(1),
+                                                 y.col(2),
+                                                 y.col(3),
+                                                 measure);
+             checksum += measure(0);
+           }));
+    report("batch projection", nanosecondsPerElement(count, iterations, [&]() {
+             checksum += subj::batchProjection(belief, uncertainty, base_rate)(0, 0);
+           }));
+    report("batch projected distance", nanosecondsPerElement(count, iterations, [&]() {
+             checksum += subj::batchProjectedDistance(
+               belief, uncertainty, base_rate, belief_b, uncertainty, base_rate)(0);
+           }));
+    report("histogram insert", nanosecondsPerElement(count, iterations, [&]() {
+             subj::Histogram histogram(64, 0.0, 1.0);
+             histogram.insert(values);
+             checksum += static_cast<double>(histogram.histogram()(0));
+           }));
+    report("dirichlet log density", nanosecondsPerElement(count, iterations, [&]() {
+             checksum += pdf.logDensities(points)(0);
+           }));
+  }
+
+  std::cout << "(checksum " << checksum << ")" << std::endl;
+
+  return 0;
+}
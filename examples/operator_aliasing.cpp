@@ -0,0 +1,151 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Checks the two-opinion operators writing into a result which is also one of their inputs. The
+// in-place results have to match the results of the operators returning a new opinion. The
+// aliased opinion holds the only reference to a base rate shared by opinions that no longer
+// exist, so writing its base rate replaces the vector the inputs are read from. Exits with 1 on
+// a failure, run it under AddressSanitizer after changing Expression.h or the base rate handling.
+
+#include <subj/subj.h>
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+using Vector = subj::MultinomialOpinion::Vector;
+
+size_t failures = 0;
+
+void check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    ++failures;
+    std::cout << "FAILED: " << what << std::endl;
+  }
+}
+
+bool approx(const subj::MultinomialOpinion& a, const subj::MultinomialOpinion& b)
+{
+  return a.beliefMat().isApprox(b.beliefMat(), 1e-12) &&
+         std::abs(a.uncertainty() - b.uncertainty()) < 1e-12 &&
+         a.baseRateMat().isApprox(b.baseRateMat(), 1e-12);
+}
+
+// Fusion of two opinions sharing a base rate handle, the result shares the handle as well and is
+// its only holder once the inputs are gone.
+subj::MultinomialOpinion soleHolder()
+{
+  Vector base_rate(3);
+  base_rate << 0.5, 0.3, 0.2;
+  subj::BaseRateHandle shared = std::make_shared<const Vector>(base_rate);
+  Vector belief_x(3), belief_y(3);
+  belief_x << 0.2, 0.3, 0.1;
+  belief_y << 0.1, 0.2, 0.3;
+  subj::MultinomialOpinion x(belief_x, 0.4, shared);
+  subj::MultinomialOpinion y(belief_y, 0.4, shared);
+  return subj::cbf(x, y);
+}
+
+using InPlace = std::function<void(const subj::MultinomialOpinion&,
+                                   const subj::MultinomialOpinion&,
+                                   subj::MultinomialOpinion&)>;
+using Returning = std::function<subj::MultinomialOpinion(const subj::MultinomialOpinion&,
+                                                         const subj::MultinomialOpinion&)>;
+
+// Compares the operator with the result as first and as second input.
+void checkOperator(const char* name, const InPlace& in_place, const Returning& returning)
+{
+  subj::MultinomialOpinion other({0.3, 0.1, 0.2}, 0.4, {0.2, 0.2, 0.6});
+
+  subj::MultinomialOpinion first = soleHolder();
+  check(first.baseRateHandle().use_count() == 1, "the result is the only base rate holder");
+  subj::MultinomialOpinion expected = returning(first, other);
+  in_place(first, other, first);
+  check(approx(first, expected), name);
+
+  subj::MultinomialOpinion second = soleHolder();
+  expected = returning(other, second);
+  in_place(other, second, second);
+  check(approx(second, expected), name);
+}
+
+} // namespace
+
+int main()
+{
+  using subj::MultinomialOpinion;
+
+  checkOperator(
+    "abf",
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b, MultinomialOpinion& result) {
+      subj::abf(a, b, result);
+    },
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b) { return subj::abf(a, b); });
+  checkOperator(
+    "cbf",
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b, MultinomialOpinion& result) {
+      subj::cbf(a, b, result);
+    },
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b) { return subj::cbf(a, b); });
+  checkOperator(
+    "wbf",
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b, MultinomialOpinion& result) {
+      subj::wbf(a, b, result);
+    },
+    [](const MultinomialOpinion& a, const MultinomialOpinion& b) { return subj::wbf(a, b); });
+
+  // The base rate of the unfusion is a reference to the base rate of the result.
+  MultinomialOpinion opinion({0.3, 0.1, 0.2}, 0.5, {0.2, 0.2, 0.6});
+  MultinomialOpinion unfused = soleHolder();
+  MultinomialOpinion fused   = subj::cbf(unfused, opinion);
+  MultinomialOpinion expected =
+    subj::cumulativeUnfusion(fused, opinion, Vector(unfused.baseRateMat()));
+  subj::cumulativeUnfusion(fused, opinion, unfused.baseRateMat(), unfused);
+  check(approx(unfused, expected), "cumulativeUnfusion");
+
+  MultinomialOpinion discounted = soleHolder();
+  expected                      = subj::td(discounted, 0.7);
+  subj::td(discounted, 0.7, discounted);
+  check(approx(discounted, expected), "td");
+
+  std::cout << (failures == 0 ? "all checks passed" : "checks failed") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -32,6 +32,7 @@
 #
 # ---------------------------------------------------------------------
 
+import numpy as np
 import pysubj as sj
 
 # You can create binomial and multinomial opinions
@@ -121,4 +122,24 @@ print(f"CBF(mult_op1, mult_op2) = {fuse_op}\n")
 print(f"Degree of conflict DOC(bin_op1, bin_op2) = {sj.doc(bin_op1, bin_op2)}")
 print(f"DOC(mult_op1, mult_op2) = {sj.doc(mult_op1, mult_op2)}\n")
 
+# Many opinions can be processed at once without creating opinion objects.
+# Beliefs and base rates are passed as 2D numpy arrays (one opinion per row),
+# uncertainties as 1D numpy array. Segment offsets select the rows fused together:
+beliefs = np.array([[0.1, 0.1, 0.4, 0.2], [0.3, 0.1, 0.0, 0.0], [0.2, 0.2, 0.2, 0.2]])
+uncertainties = np.array([0.2, 0.6, 0.2])
+base_rates = np.full((3, 4), 0.25)
+offsets = np.array([0, 2, 3])
+b, u, a = sj.batchCbf(beliefs, uncertainties, base_rates, offsets)
+print(f"Segment-wise CBF: belief = {b}, uncertainty = {u}, base rate = {a}")
+print(f"Projections = {sj.batchProjection(beliefs, uncertainties, base_rates)}\n")
+
+# Binomial opinions stored as separate numpy arrays can be combined element-wise.
+# The arguments are broadcast against each other, just like numpy ufuncs:
+b, d, u, a = sj.ufunc.cbf(np.array([0.1, 0.8]), np.array([0.5, 0.1]), np.array([0.4, 0.1]), 0.5,
+                          0.3, 0.3, 0.4, 0.5)
+print(f"Element-wise CBF: b = {b}, d = {d}, u = {u}, a = {a}")
+projections = np.empty(2)
+sj.ufunc.projection(b, d, u, a, out=projections)
+print(f"Projections = {projections}\n")
+
 print("There are a lot more operators. See help(pysubj) for reference.")
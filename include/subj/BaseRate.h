@@ -0,0 +1,91 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_BASE_RATE_H_INCLUDED
+#define SUBJ_BASE_RATE_H_INCLUDED
+
+#include <Eigen/Dense>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace subj {
+
+// Immutable, reference counted base rate vector shared by opinions. Opinions holding the same
+// handle are known to have identical base rates, which lets the operators skip fusing them.
+using BaseRateHandle = std::shared_ptr<const Eigen::Matrix<double, Eigen::Dynamic, 1> >;
+
+// Interns base rate vectors, such that equal vectors are represented by the same handle.
+// Thread-safe.
+class BaseRateRegistry
+{
+public:
+  using Vector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+
+  BaseRateRegistry();
+  BaseRateRegistry(const BaseRateRegistry&) = delete;
+
+  BaseRateRegistry& operator=(const BaseRateRegistry&) = delete;
+
+  // Returns the handle of the given base rate, registering a copy if it is not known yet. Base
+  // rates no longer held by any opinion are purged whenever the registry has doubled in size.
+  BaseRateHandle intern(const Vector& base_rate);
+
+  // Returns the handle of the uniform base rate of the given dimension.
+  BaseRateHandle uniform(const Eigen::Index& dimensions);
+
+  // Drops all base rates not held outside of the registry and returns their number.
+  size_t purge();
+
+  // Number of registered base rates.
+  size_t size() const;
+
+  // Registry used by the opinions.
+  static BaseRateRegistry& global();
+
+private:
+  size_t purgeLocked();
+
+  mutable std::mutex m_mutex;
+  std::unordered_multimap<uint64_t, BaseRateHandle> m_handles;
+  size_t m_purge_size;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_BASE_RATE_H_INCLUDED */
@@ -0,0 +1,269 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_BATCH_H_INCLUDED
+#define SUBJ_BATCH_H_INCLUDED
+
+#include <subj/FusionMode.h>
+
+#include <Eigen/Dense>
+#include <tuple>
+
+namespace subj {
+
+// A batch of N opinions of dimension D is stored column-wise: beliefs and base rates as row-major
+// N x D matrices (one opinion per row) and uncertainties as vector of length N.
+using BatchMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using BatchVector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+
+// Segment offsets of length M + 1, segment i covers the rows [offsets(i), offsets(i + 1)).
+using SegmentOffsets = Eigen::Matrix<Eigen::Index, Eigen::Dynamic, 1>;
+
+// Result of batched operators producing opinions: (belief, uncertainty, base rate).
+using OpinionBatch = std::tuple<BatchMatrix, BatchVector, BatchMatrix>;
+
+// Possibly strided element-wise views, used by the binomial kernels. All inputs and outputs of one
+// call must have the same length.
+using BatchVectorIn  = Eigen::Ref<const BatchVector, 0, Eigen::InnerStride<> >;
+using BatchVectorOut = Eigen::Ref<BatchVector, 0, Eigen::InnerStride<> >;
+
+OpinionBatch batchAveragingBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate,
+                                        const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchAveragingBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchAbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchAbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchAleatoryCumulativeBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                                 const Eigen::Ref<const BatchVector>& uncertainty,
+                                                 const Eigen::Ref<const BatchMatrix>& base_rate,
+                                                 const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchAleatoryCumulativeBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                                 const Eigen::Ref<const BatchVector>& uncertainty,
+                                                 const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchCbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchCbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchWeightedBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                       const Eigen::Ref<const BatchVector>& uncertainty,
+                                       const Eigen::Ref<const BatchMatrix>& base_rate,
+                                       const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchWeightedBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                       const Eigen::Ref<const BatchVector>& uncertainty,
+                                       const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchWbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchWbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchConsensusAndCompromiseFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                               const Eigen::Ref<const BatchVector>& uncertainty,
+                                               const Eigen::Ref<const BatchMatrix>& base_rate,
+                                               const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchConsensusAndCompromiseFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                               const Eigen::Ref<const BatchVector>& uncertainty,
+                                               const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchCcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchCcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+// Throws std::runtime_error if the opinions of a segment are totally conflicting.
+OpinionBatch batchBeliefConstraintFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                         const Eigen::Ref<const BatchVector>& uncertainty,
+                                         const Eigen::Ref<const BatchMatrix>& base_rate,
+                                         const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchBeliefConstraintFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                         const Eigen::Ref<const BatchVector>& uncertainty,
+                                         const Eigen::Ref<const BatchMatrix>& base_rate);
+
+OpinionBatch batchBcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets);
+
+OpinionBatch batchBcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+// Trust discounts every opinion with either one discount probability or one per opinion and fuses
+// the discounted opinions of each segment with the given fusion operator, without materializing
+// the discounted opinions. Equal to batchTrustDiscounting() followed by the batched fusion.
+OpinionBatch batchDiscountAndFuse(const Eigen::Ref<const BatchMatrix>& belief,
+                                  const Eigen::Ref<const BatchVector>& uncertainty,
+                                  const Eigen::Ref<const BatchMatrix>& base_rate,
+                                  const Eigen::Ref<const BatchVector>& discount_probability,
+                                  const Eigen::Ref<const SegmentOffsets>& offsets,
+                                  FusionMode mode);
+
+OpinionBatch batchDiscountAndFuse(const Eigen::Ref<const BatchMatrix>& belief,
+                                  const Eigen::Ref<const BatchVector>& uncertainty,
+                                  const Eigen::Ref<const BatchMatrix>& base_rate,
+                                  const Eigen::Ref<const BatchVector>& discount_probability,
+                                  FusionMode mode);
+
+OpinionBatch batchTrustDiscounting(const Eigen::Ref<const BatchMatrix>& belief,
+                                   const Eigen::Ref<const BatchVector>& uncertainty,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate,
+                                   const Eigen::Ref<const BatchVector>& discount_probability);
+
+OpinionBatch batchTd(const Eigen::Ref<const BatchMatrix>& belief,
+                     const Eigen::Ref<const BatchVector>& uncertainty,
+                     const Eigen::Ref<const BatchMatrix>& base_rate,
+                     const Eigen::Ref<const BatchVector>& discount_probability);
+
+BatchMatrix batchProjection(const Eigen::Ref<const BatchMatrix>& belief,
+                            const Eigen::Ref<const BatchVector>& uncertainty,
+                            const Eigen::Ref<const BatchMatrix>& base_rate);
+
+BatchVector batchProjectedDistance(const Eigen::Ref<const BatchMatrix>& belief_a,
+                                   const Eigen::Ref<const BatchVector>& uncertainty_a,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate_a,
+                                   const Eigen::Ref<const BatchMatrix>& belief_b,
+                                   const Eigen::Ref<const BatchVector>& uncertainty_b,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate_b);
+
+BatchVector batchPd(const Eigen::Ref<const BatchMatrix>& belief_a,
+                    const Eigen::Ref<const BatchVector>& uncertainty_a,
+                    const Eigen::Ref<const BatchMatrix>& base_rate_a,
+                    const Eigen::Ref<const BatchMatrix>& belief_b,
+                    const Eigen::Ref<const BatchVector>& uncertainty_b,
+                    const Eigen::Ref<const BatchMatrix>& base_rate_b);
+
+// Deduces every opinion of the batch (N x X) through the same X conditional opinions of
+// dimension Y, given as X x Y beliefs and X uncertainties. As in deduction(), the base rates of the
+// conditional opinions are replaced by the marginal base rate and therefore not needed.
+OpinionBatch batchDeduction(const Eigen::Ref<const BatchMatrix>& belief,
+                            const Eigen::Ref<const BatchVector>& uncertainty,
+                            const Eigen::Ref<const BatchMatrix>& base_rate,
+                            const Eigen::Ref<const BatchMatrix>& conditional_belief,
+                            const Eigen::Ref<const BatchVector>& conditional_uncertainty);
+
+// Element-wise operators on binomial opinions given as separate belief (b), disbelief (d),
+// uncertainty (u) and base rate (a) arrays, writing into caller provided outputs.
+void batchBinomialAveragingBeliefFusion(const BatchVectorIn& b1,
+                                        const BatchVectorIn& d1,
+                                        const BatchVectorIn& u1,
+                                        const BatchVectorIn& a1,
+                                        const BatchVectorIn& b2,
+                                        const BatchVectorIn& d2,
+                                        const BatchVectorIn& u2,
+                                        const BatchVectorIn& a2,
+                                        BatchVectorOut b,
+                                        BatchVectorOut d,
+                                        BatchVectorOut u,
+                                        BatchVectorOut a);
+
+void batchBinomialAleatoryCumulativeBeliefFusion(const BatchVectorIn& b1,
+                                                 const BatchVectorIn& d1,
+                                                 const BatchVectorIn& u1,
+                                                 const BatchVectorIn& a1,
+                                                 const BatchVectorIn& b2,
+                                                 const BatchVectorIn& d2,
+                                                 const BatchVectorIn& u2,
+                                                 const BatchVectorIn& a2,
+                                                 BatchVectorOut b,
+                                                 BatchVectorOut d,
+                                                 BatchVectorOut u,
+                                                 BatchVectorOut a);
+
+void batchBinomialTrustDiscounting(const BatchVectorIn& b_in,
+                                   const BatchVectorIn& d_in,
+                                   const BatchVectorIn& u_in,
+                                   const BatchVectorIn& a_in,
+                                   const BatchVectorIn& discount_probability,
+                                   BatchVectorOut b,
+                                   BatchVectorOut d,
+                                   BatchVectorOut u,
+                                   BatchVectorOut a);
+
+void batchBinomialProjection(const BatchVectorIn& b,
+                             const BatchVectorIn& d,
+                             const BatchVectorIn& u,
+                             const BatchVectorIn& a,
+                             BatchVectorOut projection);
+
+void batchBinomialVariance(const BatchVectorIn& b,
+                           const BatchVectorIn& d,
+                           const BatchVectorIn& u,
+                           const BatchVectorIn& a,
+                           BatchVectorOut variance);
+
+void batchBinomialDegreeOfConflict(const BatchVectorIn& b1,
+                                   const BatchVectorIn& d1,
+                                   const BatchVectorIn& u1,
+                                   const BatchVectorIn& a1,
+                                   const BatchVectorIn& b2,
+                                   const BatchVectorIn& d2,
+                                   const BatchVectorIn& u2,
+                                   const BatchVectorIn& a2,
+                                   BatchVectorOut conflict);
+
+} // namespace subj
+
+#endif /* SUBJ_BATCH_H_INCLUDED */
@@ -81,4 +81,8 @@ public:
 
 } // namespace subj
 
+#ifdef SUBJ_INLINE_ACCESSORS
+#include <subj/BinomialOpinion.inl>
+#endif
+
 #endif /* SUBJ_BINOMIAL_OPINION_H_INCLUDED */
\ No newline at end of file
@@ -0,0 +1,123 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Accessors of BinomialOpinion, included by its header if SUBJ_INLINE_ACCESSORS is defined and
+// compiled into the library otherwise.
+
+#ifndef SUBJ_BINOMIAL_OPINION_INL
+#define SUBJ_BINOMIAL_OPINION_INL
+
+namespace subj {
+
+SUBJ_INLINE bool BinomialOpinion::updateBelief(double belief)
+{
+  MultinomialOpinion::m_belief(0) = belief;
+  invalidateCache();
+
+  return true;
+}
+
+SUBJ_INLINE bool BinomialOpinion::b(double belief)
+{
+  return updateBelief(belief);
+}
+
+SUBJ_INLINE bool BinomialOpinion::updateDisbelief(double disbelief)
+{
+  MultinomialOpinion::m_belief(1) = disbelief;
+  invalidateCache();
+
+  return true;
+}
+
+SUBJ_INLINE bool BinomialOpinion::d(double disbelief)
+{
+  return updateDisbelief(disbelief);
+}
+
+SUBJ_INLINE double BinomialOpinion::belief() const
+{
+  return MultinomialOpinion::beliefMat()(0);
+}
+
+SUBJ_INLINE double BinomialOpinion::b() const
+{
+  return belief();
+}
+
+SUBJ_INLINE double BinomialOpinion::disbelief() const
+{
+  return MultinomialOpinion::beliefMat()(1);
+}
+
+SUBJ_INLINE double BinomialOpinion::d() const
+{
+  return disbelief();
+}
+
+SUBJ_INLINE double BinomialOpinion::baseRate() const
+{
+  return MultinomialOpinion::baseRateMat()(0);
+}
+
+SUBJ_INLINE double BinomialOpinion::a() const
+{
+  return baseRate();
+}
+
+SUBJ_INLINE double BinomialOpinion::projection() const
+{
+  return MultinomialOpinion::projectionMat()(0);
+}
+
+SUBJ_INLINE double BinomialOpinion::p() const
+{
+  return projection();
+}
+
+SUBJ_INLINE double BinomialOpinion::variance() const
+{
+  return MultinomialOpinion::varianceMat()(0);
+}
+
+SUBJ_INLINE double BinomialOpinion::var() const
+{
+  return variance();
+}
+
+} // namespace subj
+
+#endif /* SUBJ_BINOMIAL_OPINION_INL */
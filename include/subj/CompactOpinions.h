@@ -0,0 +1,157 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_COMPACT_OPINIONS_H_INCLUDED
+#define SUBJ_COMPACT_OPINIONS_H_INCLUDED
+
+#include <subj/Batch.h>
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace subj {
+
+class QuantizedOpinions;
+
+// Opinions of equal dimension stored column-wise in the batch layout with the given scalar type.
+// Single precision halves the memory of the batch layout, which itself needs a fraction of the
+// memory of individual opinions. Instantiated for float and double.
+template <typename Scalar>
+class OpinionColumns
+{
+public:
+  using Matrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using Vector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  // count vacuous opinions with uniform base rate.
+  OpinionColumns(const size_t& count = 0, const Eigen::Index& dimensions = 0);
+  OpinionColumns(const std::vector<MultinomialOpinion>& opinions);
+  OpinionColumns(const Eigen::Ref<const BatchMatrix>& belief,
+                 const Eigen::Ref<const BatchVector>& uncertainty,
+                 const Eigen::Ref<const BatchMatrix>& base_rate);
+
+  // Replaces the opinion at the given index, throws std::out_of_range for an invalid index and
+  // std::invalid_argument for a different dimension.
+  void set(const size_t& index, const MultinomialOpinion& opinion);
+
+  // Returns the opinion at the given index, throws std::out_of_range for an invalid index.
+  MultinomialOpinion opinion(const size_t& index) const;
+
+  std::vector<MultinomialOpinion> opinions() const;
+
+  // The opinions in double precision for the batched operators.
+  OpinionBatch batch() const;
+
+  const Matrix& belief() const;
+  const Vector& uncertainty() const;
+  const Matrix& baseRate() const;
+
+  size_t count() const;
+
+  Eigen::Index dim() const;
+
+  // Bytes of the stored values.
+  size_t bytes() const;
+
+private:
+  friend class QuantizedOpinions;
+
+  Matrix m_belief;
+  Vector m_uncertainty;
+  Matrix m_base_rate;
+};
+
+using FloatOpinionColumns  = OpinionColumns<float>;
+using DoubleOpinionColumns = OpinionColumns<double>;
+
+// Opinions of equal dimension encoded as 16-bit fixed point values for archival. The beliefs and
+// the uncertainty of an opinion are stored as one row of dim + 1 codes, its base rate as a row of
+// dim codes. Every row sums exactly to SCALE, so decoded opinions stay normalized, and each decoded
+// value differs by less than 1 / SCALE from the encoded one. A binomial opinion takes 10 bytes.
+class QuantizedOpinions
+{
+public:
+  using Code       = uint16_t;
+  using CodeMatrix = Eigen::Matrix<Code, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  static const Code SCALE = 65535;
+
+  QuantizedOpinions();
+  // The encoders throw std::invalid_argument for opinions of different dimensions and for rows
+  // which are not finite or do not have a positive sum.
+  QuantizedOpinions(const std::vector<MultinomialOpinion>& opinions);
+  QuantizedOpinions(const Eigen::Ref<const BatchMatrix>& belief,
+                    const Eigen::Ref<const BatchVector>& uncertainty,
+                    const Eigen::Ref<const BatchMatrix>& base_rate);
+  template <typename Scalar>
+  QuantizedOpinions(const OpinionColumns<Scalar>& columns);
+  // Takes codes read back from an archive, throws std::invalid_argument if their shapes do not
+  // match or a row does not sum to SCALE.
+  QuantizedOpinions(const CodeMatrix& mass, const CodeMatrix& base_rate);
+
+  // Decodes the opinion at the given index, throws std::out_of_range for an invalid index.
+  MultinomialOpinion opinion(const size_t& index) const;
+
+  // Decodes all opinions. Consecutive opinions with equal base rate codes share their base rate.
+  std::vector<MultinomialOpinion> opinions() const;
+
+  OpinionBatch batch() const;
+
+  template <typename Scalar>
+  OpinionColumns<Scalar> columns() const;
+
+  // Beliefs followed by the uncertainty, one opinion per row.
+  const CodeMatrix& mass() const;
+  const CodeMatrix& baseRate() const;
+
+  size_t count() const;
+
+  Eigen::Index dim() const;
+
+  size_t bytes() const;
+
+private:
+  CodeMatrix m_mass;
+  CodeMatrix m_base_rate;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_COMPACT_OPINIONS_H_INCLUDED */
@@ -0,0 +1,99 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_DECAYING_OPINION_H_INCLUDED
+#define SUBJ_DECAYING_OPINION_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+
+namespace subj {
+
+// Scales the evidence behind the opinion by factor in [0, 1] and returns the resulting opinion.
+// With r = W * b / u this gives b' = factor * b / (u + factor * (1 - u)), so the uncertainty grows
+// back toward 1 as the factor goes to 0. Dogmatic opinions (u = 0) keep their belief unless the
+// factor is 0.
+MultinomialOpinion evidenceDecay(const MultinomialOpinion& opinion, const double& factor);
+
+// Opinion whose evidence decays exponentially with the given half-life. The decay is not applied
+// continuously but computed in closed form from the elapsed time whenever the opinion is read or
+// fused, so idle opinions cost nothing. Timestamps use an arbitrary but common unit and origin.
+class DecayingOpinion
+{
+public:
+  DecayingOpinion() = delete;
+  DecayingOpinion(const MultinomialOpinion& opinion,
+                  const double& timestamp,
+                  const double& half_life);
+
+  // The opinion as seen at the given time. Times before the last update return the opinion of the
+  // last update.
+  MultinomialOpinion opinion(const double& time) const;
+
+  MultinomialOpinion at(const double& time) const;
+
+  // Decays the stored opinion to the given time and fuses the observed opinion into it by
+  // aleatory cumulative belief fusion. Observations older than the last update are decayed to the
+  // time of the last update instead.
+  void fuseIn(const MultinomialOpinion& opinion, const double& time);
+
+  // Replaces the stored opinion by the given one, observed at the given time.
+  void update(const MultinomialOpinion& opinion, const double& time);
+
+  // The opinion as of the last update, without decay.
+  const MultinomialOpinion& storedOpinion() const;
+
+  double timestamp() const;
+
+  double halfLife() const;
+
+  // Factor by which the evidence decays over the elapsed time.
+  double decayFactor(const double& elapsed) const;
+
+  Eigen::Index dim() const;
+
+private:
+  MultinomialOpinion m_opinion;
+  double m_timestamp;
+  double m_half_life;
+  double m_decay_rate;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_DECAYING_OPINION_H_INCLUDED */
@@ -37,6 +37,8 @@
 #ifndef SUBJ_DIRICHLET_PDF_H_INCLUDED
 #define SUBJ_DIRICHLET_PDF_H_INCLUDED
 
+#include <subj/Batch.h>
+
 #include <Eigen/Dense>
 #include <cmath>
 #include <initializer_list>
@@ -52,24 +54,30 @@ public:
 
   void updateEvidence(const std::initializer_list<double>& evidence);
   void updateEvidence(const std::vector<double>& evidence);
-  void updateEvidence(const Eigen::Matrix<double, Eigen::Dynamic, 1>& evidence);
+  void updateEvidence(const Eigen::Ref<const Eigen::VectorXd>& evidence);
 
   void updateBaseRate(const std::initializer_list<double>& base_rate);
   void updateBaseRate(const std::vector<double>& base_rate);
-  void updateBaseRate(const Eigen::Matrix<double, Eigen::Dynamic, 1>& base_rate);
+  void updateBaseRate(const Eigen::Ref<const Eigen::VectorXd>& base_rate);
 
   std::vector<double> evidence() const;
-  Eigen::VectorXd evidenceMat() const;
+  const Eigen::VectorXd& evidenceMat() const;
 
   std::vector<double> baseRate() const;
-  Eigen::VectorXd baseRateMat() const;
+  const Eigen::VectorXd& baseRateMat() const;
 
   std::vector<double> strength() const;
   Eigen::VectorXd strengthMat() const;
 
   double density(const std::initializer_list<double>& x) const;
   double density(const std::vector<double>& x) const;
-  double density(const Eigen::Matrix<double, Eigen::Dynamic, 1>& x) const;
+  double density(const Eigen::Ref<const Eigen::VectorXd>& x) const;
+
+  // Log of density(), computed with lgamma and log and therefore without overflow for large
+  // strengths. Throws std::invalid_argument if the dimension of x does not match.
+  double logDensity(const Eigen::Ref<const Eigen::VectorXd>& x) const;
+  // Log densities at the points given as rows of x.
+  BatchVector logDensities(const Eigen::Ref<const BatchMatrix>& x) const;
 
   friend std::ostream& operator<<(std::ostream& os, const DirichletPDF& pdf);
 
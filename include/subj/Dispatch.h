@@ -0,0 +1,72 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_DISPATCH_H_INCLUDED
+#define SUBJ_DISPATCH_H_INCLUDED
+
+namespace subj {
+
+// Instruction set levels the numeric kernels (binomial operators, batch projection and distance,
+// histogram binning and Dirichlet log densities) are compiled for. AVX2 includes FMA, AVX512
+// includes the F, DQ, BW and VL extensions. Only BASELINE exists on non-x86 targets.
+enum class IsaLevel
+{
+  BASELINE,
+  AVX2,
+  AVX512
+};
+
+// Highest level supported by the CPU (and the operating system) the library runs on.
+IsaLevel supportedIsaLevel();
+
+bool isaSupported(IsaLevel level);
+
+// Level the numeric kernels run with. It is selected via CPUID when the kernels are first used:
+// the highest supported level, or the level named by the environment variable SUBJ_ISA
+// (baseline, avx2 or avx512) if it is supported. Unknown or unsupported names are ignored.
+IsaLevel isaLevel();
+
+// Switches the numeric kernels to the given level, e.g. to compare levels in benchmarks. Calls
+// running concurrently finish with the level they started with. Throws std::invalid_argument if
+// the level is not supported.
+void setIsaLevel(IsaLevel level);
+
+// Lower case name of the level, as accepted by SUBJ_ISA.
+const char* isaName(IsaLevel level);
+
+} // namespace subj
+
+#endif /* SUBJ_DISPATCH_H_INCLUDED */
@@ -0,0 +1,83 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_EVIDENCE_INGESTION_H_INCLUDED
+#define SUBJ_EVIDENCE_INGESTION_H_INCLUDED
+
+#include <subj/Batch.h>
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <string>
+#include <vector>
+
+namespace subj {
+
+// Evidence aggregated per entity. Row i of evidence and timestamp belongs to keys[i], keys are in
+// order of their first occurrence in the input.
+struct EvidenceTable
+{
+  std::vector<std::string> keys;
+  BatchMatrix evidence;
+  BatchVector timestamp;
+};
+
+// Parses delimited lines of the form "entity_id,category,count[,timestamp]" and sums the counts per
+// entity and category. Categories are indices in [0, dimensions), counts are finite and not
+// negative, the timestamp of an entity is the latest one seen. The input is split into chunks at
+// line boundaries, which are parsed in parallel. Throws std::runtime_error on malformed lines.
+EvidenceTable ingestEvidence(const char* data,
+                             size_t size,
+                             Eigen::Index dimensions,
+                             char delimiter = ',',
+                             bool skip_header = false);
+
+// Same as above, reading the file at path through a read-only memory mapping.
+EvidenceTable ingestEvidenceFile(const std::string& path,
+                                 Eigen::Index dimensions,
+                                 char delimiter = ',',
+                                 bool skip_header = false);
+
+// Opinions of the aggregated evidence with the given base rate, following
+// MultinomialOpinion::update(DirichletPDF&).
+OpinionBatch evidenceOpinionBatch(const EvidenceTable& table, const Eigen::VectorXd& base_rate);
+
+std::vector<MultinomialOpinion> evidenceOpinions(const EvidenceTable& table,
+                                                 const Eigen::VectorXd& base_rate);
+
+} // namespace subj
+
+#endif /* SUBJ_EVIDENCE_INGESTION_H_INCLUDED */
@@ -0,0 +1,140 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_EXECUTOR_H_INCLUDED
+#define SUBJ_EXECUTOR_H_INCLUDED
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace subj {
+
+namespace detail {
+class WorkStealingPool;
+}
+
+// Runs the tasks of the parallel operators: the batched operators, the batched Dirichlet densities,
+// histogram insertion, owner trust discounting, evidence ingestion and the evaluation of trust
+// networks, opinion graphs and subjective networks. All of them share one executor, see
+// setExecutor(), so concurrent callers do not oversubscribe the machine.
+class Executor
+{
+public:
+  virtual ~Executor() = default;
+
+  // Number of threads working on a call of run(), including the calling thread. Calls are split
+  // into tasks accordingly, an executor with a concurrency of 1 is never called.
+  virtual size_t concurrency() const = 0;
+
+  // Calls task(i) once for every i in [0, count) and returns when all calls have finished. Tasks
+  // may run concurrently and on any thread, and may call run() again. Implementations must
+  // therefore not block a thread on tasks queued behind it. The tasks of the library do not throw.
+  virtual void run(size_t count, const std::function<void(size_t)>& task) = 0;
+};
+
+// Runs every task in the calling thread, in order.
+class SerialExecutor : public Executor
+{
+public:
+  size_t concurrency() const override;
+  void run(size_t count, const std::function<void(size_t)>& task) override;
+};
+
+// Thread pool with one task queue per thread. Ranges of tasks are halved whenever a thread takes
+// them, the thread keeps working on the lower half and queues the upper one. Threads take the
+// newest range of their own queue and steal the oldest one of another queue when theirs is empty.
+// The thread calling run() works on the queued tasks until its call has finished, which makes
+// nested calls safe. The first exception thrown by a task is rethrown by run().
+class WorkStealingExecutor : public Executor
+{
+public:
+  // Number of threads including the calling thread, 0 for one per hardware thread.
+  explicit WorkStealingExecutor(size_t threads = 0);
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  ~WorkStealingExecutor() override;
+
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  size_t concurrency() const override;
+  void run(size_t count, const std::function<void(size_t)>& task) override;
+
+private:
+  size_t m_threads;
+  std::unique_ptr<detail::WorkStealingPool> m_pool;
+};
+
+// Executor the library starts with, created on first use. A WorkStealingExecutor with the number
+// of threads given by the environment variable SUBJ_NUM_THREADS, or one per hardware thread. A
+// single thread selects the SerialExecutor.
+std::shared_ptr<Executor> defaultExecutor();
+
+// Executor of all parallel operators.
+std::shared_ptr<Executor> executor();
+
+// Replaces the executor of all parallel operators, e.g. with one wrapping the thread pool of the
+// application. Calls running concurrently finish on the executor they started with. A null
+// executor restores defaultExecutor().
+void setExecutor(std::shared_ptr<Executor> executor);
+
+// Parallelism hint for the operators called by the current thread while the scope exists, also
+// applied to the operators called from their tasks. Each call is split into at most max_tasks
+// tasks, 0 removes the limit. A limit of 1 is the serial fallback: every call runs in the calling
+// thread, over its items in order, without involving the executor. Scopes nest.
+//
+//   {
+//     ParallelScope serial(1);
+//     OpinionBatch fused = batchCbf(belief, uncertainty, base_rate, offsets);
+//   }
+class ParallelScope
+{
+public:
+  explicit ParallelScope(size_t max_tasks);
+  ParallelScope(const ParallelScope&) = delete;
+  ~ParallelScope();
+
+  ParallelScope& operator=(const ParallelScope&) = delete;
+
+  // Limit of the current thread, 0 if there is none.
+  static size_t maxTasks();
+
+private:
+  size_t m_previous;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_EXECUTOR_H_INCLUDED */
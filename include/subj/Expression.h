@@ -0,0 +1,441 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_EXPRESSION_H_INCLUDED
+#define SUBJ_EXPRESSION_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <stdexcept>
+#include <type_traits>
+
+namespace subj {
+
+// Lazily evaluated compositions of the two-opinion operators. Building an expression like
+//
+//   expr::cbf(expr::td(x, p1), expr::td(y, p2))
+//
+// only records the operands and computes the scalar parts (uncertainties and normalizations) in
+// O(1). The beliefs and base rates are computed in a single pass over the inputs when the
+// expression is assigned to an opinion, without intermediate opinions. If all inputs share the
+// same base rate handle, the result shares it as well and only the beliefs are computed. Like
+// Eigen expressions, expressions reference their input opinions and must not outlive them.
+namespace expr {
+
+template <typename Derived>
+struct OpinionExpression
+{
+  const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+  // Evaluates the expression into a new opinion.
+  operator MultinomialOpinion() const;
+};
+
+// Reference to an existing opinion.
+class OpinionRef : public OpinionExpression<OpinionRef>
+{
+public:
+  explicit OpinionRef(const MultinomialOpinion& opinion)
+    : m_belief(detail::OpinionAccess::belief(opinion).data())
+    , m_base_rate(detail::OpinionAccess::baseRate(opinion).data())
+    , m_base_rate_handle(&detail::OpinionAccess::baseRateHandle(opinion))
+    , m_uncertainty(opinion.uncertainty())
+    , m_dim(opinion.dim())
+  {
+  }
+
+  Eigen::Index dim() const { return m_dim; }
+  double uncertainty() const { return m_uncertainty; }
+  double belief(Eigen::Index i) const { return m_belief[i]; }
+  double baseRate(Eigen::Index i) const { return m_base_rate[i]; }
+
+  // Base rate handle shared by all inputs, nullptr if they do not share one.
+  const BaseRateHandle* baseRateHandle() const { return m_base_rate_handle; }
+
+private:
+  const double* m_belief;
+  const double* m_base_rate;
+  const BaseRateHandle* m_base_rate_handle;
+  double m_uncertainty;
+  Eigen::Index m_dim;
+};
+
+// Operands are either expressions, stored by value, or opinions, wrapped into an OpinionRef.
+template <typename T, typename Enable = void>
+struct Operand
+{
+  using type = T;
+  static const T& make(const T& t) { return t; }
+};
+
+template <typename T>
+struct Operand<T, typename std::enable_if<std::is_base_of<MultinomialOpinion, T>::value>::type>
+{
+  using type = OpinionRef;
+  static OpinionRef make(const MultinomialOpinion& opinion) { return OpinionRef(opinion); }
+};
+
+// trustDiscounting()
+template <typename E>
+class TrustDiscounting : public OpinionExpression<TrustDiscounting<E> >
+{
+public:
+  TrustDiscounting(const E& e, double discount_probability)
+    : m_e(e)
+    , m_p(discount_probability)
+    , m_uncertainty(1.0 - discount_probability * (1.0 - e.uncertainty()))
+  {
+  }
+
+  Eigen::Index dim() const { return m_e.dim(); }
+  double uncertainty() const { return m_uncertainty; }
+  double belief(Eigen::Index i) const { return m_p * m_e.belief(i); }
+  double baseRate(Eigen::Index i) const { return m_e.baseRate(i); }
+  const BaseRateHandle* baseRateHandle() const { return m_e.baseRateHandle(); }
+
+private:
+  E m_e;
+  double m_p;
+  double m_uncertainty;
+};
+
+// Weights of a two-opinion fusion: the fused belief and base rate are weighted sums of those of
+// the operands, the fused uncertainty is a scalar.
+struct FusionWeights
+{
+  double belief_a;
+  double belief_b;
+  double base_rate_a;
+  double base_rate_b;
+  double uncertainty;
+
+  // aleatoryCumulativeBeliefFusion(), fusing two vacuous opinions returns the first one
+  static FusionWeights cumulative(double u_a, double u_b)
+  {
+    if (u_a == 1.0 && u_b == 1.0)
+    {
+      return {1.0, 0.0, 1.0, 0.0, 1.0};
+    }
+    double u_ab = u_a * u_b;
+    double norm = u_a + u_b - u_ab;
+    if (norm == 0.0)
+    {
+      return {0.5, 0.5, 0.5, 0.5, 0.0};
+    }
+    double base_norm = u_a + u_b - 2.0 * u_ab;
+    return {u_b / norm,
+            u_a / norm,
+            (u_b - u_ab) / base_norm,
+            (u_a - u_ab) / base_norm,
+            u_ab / norm};
+  }
+
+  // averagingBeliefFusion()
+  static FusionWeights averaging(double u_a, double u_b)
+  {
+    double u_ab      = u_a * u_b;
+    double norm      = u_a + u_b;
+    double base_norm = u_a + u_b - 2.0 * u_ab;
+    if (norm == 0.0)
+    {
+      return {0.5, 0.5, 0.5, 0.5, 0.0};
+    }
+    if (base_norm == 0.0)
+    {
+      return {u_b / norm, u_a / norm, 0.5, 0.5, 2.0 * u_ab / norm};
+    }
+    return {u_b / norm,
+            u_a / norm,
+            (u_b - u_ab) / base_norm,
+            (u_a - u_ab) / base_norm,
+            2.0 * u_ab / norm};
+  }
+
+  // weightedBeliefFusion(), each opinion weighted by its confidence 1 - u
+  static FusionWeights weighted(double u_a, double u_b)
+  {
+    double c_a = 1.0 - u_a;
+    double c_b = 1.0 - u_b;
+    if (c_a + c_b == 0.0)
+    {
+      return {0.0, 0.0, 0.5, 0.5, 1.0};
+    }
+    double u_ab = u_a * u_b;
+    double norm = u_a + u_b - 2.0 * u_ab;
+    if (norm == 0.0)
+    {
+      return {0.5, 0.5, 0.5, 0.5, 0.0};
+    }
+    return {c_a * u_b / norm,
+            c_b * u_a / norm,
+            c_a / (c_a + c_b),
+            c_b / (c_a + c_b),
+            (c_a + c_b) * u_ab / norm};
+  }
+};
+
+// Two-opinion fusion with the given weights.
+template <typename Derived, typename A, typename B>
+class BinaryFusion : public OpinionExpression<Derived>
+{
+public:
+  BinaryFusion(const A& a, const B& b, FusionWeights (*weights)(double, double))
+    : m_a(a)
+    , m_b(b)
+  {
+    if (a.dim() != b.dim())
+    {
+      throw std::runtime_error("All opinions must have the same dimensions!");
+    }
+    m_weights = weights(a.uncertainty(), b.uncertainty());
+  }
+
+  Eigen::Index dim() const { return m_a.dim(); }
+  double uncertainty() const { return m_weights.uncertainty; }
+
+  double belief(Eigen::Index i) const
+  {
+    return m_weights.belief_a * m_a.belief(i) + m_weights.belief_b * m_b.belief(i);
+  }
+
+  double baseRate(Eigen::Index i) const
+  {
+    return m_weights.base_rate_a * m_a.baseRate(i) + m_weights.base_rate_b * m_b.baseRate(i);
+  }
+
+  // The base rate weights sum up to 1, fusing a shared base rate results in the same one.
+  const BaseRateHandle* baseRateHandle() const
+  {
+    const BaseRateHandle* a = m_a.baseRateHandle();
+    const BaseRateHandle* b = m_b.baseRateHandle();
+    return (a != nullptr && b != nullptr && *a == *b) ? a : nullptr;
+  }
+
+private:
+  A m_a;
+  B m_b;
+  FusionWeights m_weights;
+};
+
+template <typename A, typename B>
+class CumulativeFusion : public BinaryFusion<CumulativeFusion<A, B>, A, B>
+{
+public:
+  CumulativeFusion(const A& a, const B& b)
+    : BinaryFusion<CumulativeFusion<A, B>, A, B>(a, b, &FusionWeights::cumulative)
+  {
+  }
+};
+
+template <typename A, typename B>
+class AveragingFusion : public BinaryFusion<AveragingFusion<A, B>, A, B>
+{
+public:
+  AveragingFusion(const A& a, const B& b)
+    : BinaryFusion<AveragingFusion<A, B>, A, B>(a, b, &FusionWeights::averaging)
+  {
+  }
+};
+
+template <typename A, typename B>
+class WeightedFusion : public BinaryFusion<WeightedFusion<A, B>, A, B>
+{
+public:
+  WeightedFusion(const A& a, const B& b)
+    : BinaryFusion<WeightedFusion<A, B>, A, B>(a, b, &FusionWeights::weighted)
+  {
+  }
+};
+
+// cumulativeUnfusion(), removing the opinion from the fused one. The base rate is referenced like
+// an opinion.
+template <typename F, typename E>
+class CumulativeUnfusion : public OpinionExpression<CumulativeUnfusion<F, E> >
+{
+public:
+  CumulativeUnfusion(const F& fused, const E& e, const Eigen::VectorXd& base_rate)
+    : m_fused(fused)
+    , m_e(e)
+    , m_base_rate(base_rate.data())
+  {
+    if (fused.dim() != e.dim() || base_rate.rows() != e.dim())
+    {
+      throw std::runtime_error("All opinions must have the same dimensions!");
+    }
+    double u_f     = fused.uncertainty();
+    double u_e     = e.uncertainty();
+    double norm    = u_e - u_f + u_e * u_f;
+    m_weight_fused = u_e / norm;
+    m_weight_e     = -u_f / norm;
+    m_uncertainty  = u_e * u_f / norm;
+  }
+
+  Eigen::Index dim() const { return m_e.dim(); }
+  double uncertainty() const { return m_uncertainty; }
+
+  double belief(Eigen::Index i) const
+  {
+    return m_weight_fused * m_fused.belief(i) + m_weight_e * m_e.belief(i);
+  }
+
+  double baseRate(Eigen::Index i) const { return m_base_rate[i]; }
+  const BaseRateHandle* baseRateHandle() const { return nullptr; }
+
+private:
+  F m_fused;
+  E m_e;
+  const double* m_base_rate;
+  double m_weight_fused;
+  double m_weight_e;
+  double m_uncertainty;
+};
+
+// Evaluates the expression into the given opinion in one pass. The opinion may be one of the
+// inputs of the expression, it is only reallocated if its dimension differs.
+template <typename E>
+void evaluate(const OpinionExpression<E>& expression, MultinomialOpinion& result)
+{
+  const E& e = expression.derived();
+  // The uncertainty and shared base rate have to be read before the result, which may be an input,
+  // is overwritten. Writing the base rate of the result may replace its vector by a copy, the
+  // inputs keep reading the original one, so it is held until the loop is done.
+  BaseRateHandle keep          = detail::OpinionAccess::baseRateHandle(result);
+  double uncertainty           = e.uncertainty();
+  const BaseRateHandle* handle = e.baseRateHandle();
+  BaseRateHandle shared        = handle != nullptr ? *handle : BaseRateHandle();
+  Eigen::Index dim             = e.dim();
+  detail::OpinionAccess::resize(result, dim);
+  double* belief = detail::OpinionAccess::belief(result).data();
+
+  if (shared)
+  {
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief[i] = e.belief(i);
+    }
+    detail::OpinionAccess::shareBaseRate(result, shared);
+    result.updateUncertainty(uncertainty);
+    return;
+  }
+
+  double* base_rate = detail::OpinionAccess::baseRate(result).data();
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    double b     = e.belief(i);
+    double a     = e.baseRate(i);
+    belief[i]    = b;
+    base_rate[i] = a;
+  }
+  result.updateUncertainty(uncertainty);
+}
+
+template <typename E>
+OpinionExpression<E>::operator MultinomialOpinion() const
+{
+  MultinomialOpinion result(static_cast<uint32_t>(derived().dim()));
+  evaluate(*this, result);
+  return result;
+}
+
+template <typename E>
+TrustDiscounting<typename Operand<E>::type> td(const E& e, double discount_probability)
+{
+  return TrustDiscounting<typename Operand<E>::type>(Operand<E>::make(e), discount_probability);
+}
+
+template <typename E>
+TrustDiscounting<typename Operand<E>::type> trustDiscounting(const E& e,
+                                                             double discount_probability)
+{
+  return td(e, discount_probability);
+}
+
+template <typename A, typename B>
+CumulativeFusion<typename Operand<A>::type, typename Operand<B>::type> cbf(const A& a, const B& b)
+{
+  return CumulativeFusion<typename Operand<A>::type, typename Operand<B>::type>(
+    Operand<A>::make(a), Operand<B>::make(b));
+}
+
+template <typename A, typename B>
+CumulativeFusion<typename Operand<A>::type, typename Operand<B>::type>
+aleatoryCumulativeBeliefFusion(const A& a, const B& b)
+{
+  return cbf(a, b);
+}
+
+template <typename A, typename B>
+AveragingFusion<typename Operand<A>::type, typename Operand<B>::type> abf(const A& a, const B& b)
+{
+  return AveragingFusion<typename Operand<A>::type, typename Operand<B>::type>(
+    Operand<A>::make(a), Operand<B>::make(b));
+}
+
+template <typename A, typename B>
+AveragingFusion<typename Operand<A>::type, typename Operand<B>::type>
+averagingBeliefFusion(const A& a, const B& b)
+{
+  return abf(a, b);
+}
+
+template <typename A, typename B>
+WeightedFusion<typename Operand<A>::type, typename Operand<B>::type> wbf(const A& a, const B& b)
+{
+  return WeightedFusion<typename Operand<A>::type, typename Operand<B>::type>(
+    Operand<A>::make(a), Operand<B>::make(b));
+}
+
+template <typename A, typename B>
+WeightedFusion<typename Operand<A>::type, typename Operand<B>::type>
+weightedBeliefFusion(const A& a, const B& b)
+{
+  return wbf(a, b);
+}
+
+template <typename F, typename E>
+CumulativeUnfusion<typename Operand<F>::type, typename Operand<E>::type>
+cumulativeUnfusion(const F& fused, const E& e, const Eigen::VectorXd& base_rate)
+{
+  return CumulativeUnfusion<typename Operand<F>::type, typename Operand<E>::type>(
+    Operand<F>::make(fused), Operand<E>::make(e), base_rate);
+}
+
+} // namespace expr
+} // namespace subj
+
+#endif /* SUBJ_EXPRESSION_H_INCLUDED */
@@ -52,6 +52,9 @@ public:
             const Eigen::Matrix<double, Eigen::Dynamic, 1>& data,
             double min_value,
             double max_value);
+  Histogram(const Eigen::Matrix<size_t, Eigen::Dynamic, 1>& histogram,
+            const Eigen::Matrix<double, Eigen::Dynamic, 2>& intervals,
+            size_t data_count);
 
   void insert(double value);
   void insertIntoBin(size_t bin);
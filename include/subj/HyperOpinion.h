@@ -46,26 +46,28 @@ namespace subj {
 class HyperOpinion
 {
 public:
-  using DVector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
-  using RVector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+  using DVector    = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+  using RVector    = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+  using DVectorRef = Eigen::Ref<const DVector>;
+  using RVectorRef = Eigen::Ref<const RVector>;
 
   HyperOpinion();
 
-  HyperOpinion(const RVector& belief, const double& uncertainty, const DVector& base_rate);
+  HyperOpinion(const RVectorRef& belief, const double& uncertainty, const DVectorRef& base_rate);
 
-  void update(const RVector& belief, const double& uncertainty, const DVector& base_rate);
+  void update(const RVectorRef& belief, const double& uncertainty, const DVectorRef& base_rate);
 
-  void updateBelief(const RVector& belief);
+  void updateBelief(const RVectorRef& belief);
 
-  RVector belief() const;
+  const RVector& belief() const;
 
   void updateUncertainty(const double& uncertainty);
 
   double uncertainty() const;
 
-  void updateBaseRate(const DVector& base_rate);
+  void updateBaseRate(const DVectorRef& base_rate);
 
-  DVector baseRate() const;
+  const DVector& baseRate() const;
 
   void updateOwner(const OpinionOwner& owner);
 
@@ -37,20 +37,199 @@
 #ifndef SUBJ_MULTINOMIALOPINION_H
 #define SUBJ_MULTINOMIALOPINION_H
 
+#include <subj/BaseRate.h>
 #include <subj/DirichletPDF.h>
+#include <subj/Inline.h>
 #include <subj/OpinionOwner.h>
 
 #include <Eigen/Dense>
+#include <atomic>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <vector>
 
 namespace subj {
 
+namespace detail {
+struct OpinionAccess;
+
+// Vector derived from an opinion, computed on first use and kept until invalidated. Concurrent
+// readers compute it once, the others wait for it and take over if the computation failed.
+// Invalidating must not happen concurrently with reading, like any other modification of the
+// opinion.
+class CachedVector
+{
+public:
+  using Vector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+
+  CachedVector()
+    : m_state(INVALID)
+  {
+  }
+
+  CachedVector(const CachedVector&) = delete;
+  CachedVector& operator=(const CachedVector&) = delete;
+
+  // Returns the vector, computing it by compute(Vector&) if it is invalid.
+  template <typename Compute>
+  const Vector& get(Compute compute) const
+  {
+    if (m_state.load(std::memory_order_acquire) != VALID)
+    {
+      fill(compute);
+    }
+    return m_value;
+  }
+
+  void invalidate() { m_state.store(INVALID, std::memory_order_relaxed); }
+
+private:
+  enum State
+  {
+    INVALID,
+    COMPUTING,
+    VALID
+  };
+
+  template <typename Compute>
+  void fill(Compute compute) const
+  {
+    int expected = INVALID;
+    while (!m_state.compare_exchange_strong(expected, COMPUTING, std::memory_order_acquire))
+    {
+      // Another reader is computing the vector. If it fails, the state drops back to INVALID and
+      // this reader retries the computation itself.
+      while (expected == COMPUTING)
+      {
+        std::this_thread::yield();
+        expected = m_state.load(std::memory_order_acquire);
+      }
+      if (expected == VALID)
+      {
+        return;
+      }
+    }
+    try
+    {
+      compute(m_value);
+    }
+    catch (...)
+    {
+      m_state.store(INVALID, std::memory_order_release);
+      throw;
+    }
+    m_state.store(VALID, std::memory_order_release);
+  }
+
+  mutable std::atomic<int> m_state;
+  mutable Vector m_value;
+};
+
+// Projection, variance and evidence cached by an opinion. The vectors live in one block allocated
+// on first use, so opinions that are never queried only pay for a pointer. Copies start out
+// empty, moves take the block along with the opinion data.
+class OpinionCache
+{
+public:
+  enum Slot
+  {
+    PROJECTION,
+    VARIANCE,
+    EVIDENCE,
+    SLOT_COUNT
+  };
+
+  OpinionCache() noexcept
+    : m_block(nullptr)
+  {
+  }
+
+  OpinionCache(const OpinionCache&) noexcept
+    : m_block(nullptr)
+  {
+  }
+
+  OpinionCache(OpinionCache&& other) noexcept
+    : m_block(other.release())
+  {
+  }
+
+  ~OpinionCache() { delete m_block.load(std::memory_order_relaxed); }
+
+  OpinionCache& operator=(const OpinionCache&) noexcept
+  {
+    invalidate();
+    return *this;
+  }
+
+  OpinionCache& operator=(OpinionCache&& other) noexcept
+  {
+    if (this != &other)
+    {
+      delete m_block.load(std::memory_order_relaxed);
+      m_block.store(other.release(), std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  // Returns the vector in the given slot, computing it by compute(Vector&) if it is invalid.
+  template <typename Compute>
+  const CachedVector::Vector& get(Slot slot, Compute compute) const
+  {
+    Block* block = m_block.load(std::memory_order_acquire);
+    if (block == nullptr)
+    {
+      block = allocate();
+    }
+    return block->vectors[slot].get(compute);
+  }
+
+  void invalidate() noexcept
+  {
+    Block* block = m_block.load(std::memory_order_relaxed);
+    if (block != nullptr)
+    {
+      for (CachedVector& vector : block->vectors)
+      {
+        vector.invalidate();
+      }
+    }
+  }
+
+private:
+  struct Block
+  {
+    CachedVector vectors[SLOT_COUNT];
+  };
+
+  // Installs a new block unless a concurrent reader was faster, in which case that one is used.
+  Block* allocate() const
+  {
+    Block* created  = new Block;
+    Block* expected = nullptr;
+    if (m_block.compare_exchange_strong(expected, created, std::memory_order_acq_rel))
+    {
+      return created;
+    }
+    delete created;
+    return expected;
+  }
+
+  Block* release() noexcept { return m_block.exchange(nullptr, std::memory_order_relaxed); }
+
+  mutable std::atomic<Block*> m_block;
+};
+
+} // namespace detail
+
 class MultinomialOpinion
 {
 public:
   using Vector = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+  // Read-only view binding vectors, maps of std::vectors and matrix columns without a copy.
+  using VectorRef = Eigen::Ref<const Vector>;
 
   MultinomialOpinion() = delete;
   MultinomialOpinion(const uint32_t& dimensions);
@@ -60,7 +239,12 @@ public:
   MultinomialOpinion(const std::vector<double>& belief,
                      const double& uncertainty,
                      const std::vector<double>& base_rate);
-  MultinomialOpinion(const Vector& belief, const double& uncertainty, const Vector& base_rate);
+  MultinomialOpinion(const VectorRef& belief,
+                     const double& uncertainty,
+                     const VectorRef& base_rate);
+  MultinomialOpinion(const VectorRef& belief,
+                     const double& uncertainty,
+                     const BaseRateHandle& base_rate);
 
   bool update(const std::initializer_list<double>& belief,
               const double& uncertainty,
@@ -68,21 +252,21 @@ public:
   bool update(const std::vector<double>& belief,
               const double& uncertainty,
               const std::vector<double>& base_rate);
-  bool update(const Vector& belief, const double& uncertainty, const Vector& base_rate);
+  bool update(const VectorRef& belief, const double& uncertainty, const VectorRef& base_rate);
 
   bool updateBelief(const std::initializer_list<double>& belief);
   bool updateBelief(const std::vector<double>& belief);
-  bool updateBelief(const Vector& belief);
+  bool updateBelief(const VectorRef& belief);
 
   bool b(const std::initializer_list<double>& belief);
   bool b(const std::vector<double>& belief);
-  bool b(const Vector& belief);
+  bool b(const VectorRef& belief);
 
   std::vector<double> belief() const;
-  Vector beliefMat() const;
+  const Vector& beliefMat() const;
 
   std::vector<double> b() const;
-  Vector bMat() const;
+  const Vector& bMat() const;
 
   bool updateUncertainty(const double& uncertainty);
 
@@ -94,17 +278,28 @@ public:
 
   bool updateBaseRate(const std::initializer_list<double>& base_rate);
   bool updateBaseRate(const std::vector<double>& base_rate);
-  bool updateBaseRate(const Vector& base_rate);
+  bool updateBaseRate(const VectorRef& base_rate);
+  // Shares the given base rate, fails for a null handle or a different dimension.
+  bool updateBaseRate(const BaseRateHandle& base_rate);
 
   bool a(const std::initializer_list<double>& base_rate);
   bool a(const std::vector<double>& base_rate);
-  bool a(const Vector& base_rate);
+  bool a(const VectorRef& base_rate);
 
   std::vector<double> baseRate() const;
-  Vector baseRateMat() const;
+  const Vector& baseRateMat() const;
 
   std::vector<double> a() const;
-  Vector aMat() const;
+  const Vector& aMat() const;
+
+  // Base rate of the opinion, shared with its copies until one of them modifies it.
+  const BaseRateHandle& baseRateHandle() const;
+
+  // Replaces the base rate by the equal one of the global BaseRateRegistry.
+  void internBaseRate();
+
+  // True if both opinions hold the same base rate handle, which implies equal base rates.
+  bool sharesBaseRate(const MultinomialOpinion& other) const;
 
   OpinionOwner owner() const;
 
@@ -116,17 +311,23 @@ public:
 
   void update(DirichletPDF& pdf);
 
+  // The projection, variance and evidence are computed on first use and cached until the opinion
+  // is modified.
   std::vector<double> projection() const;
-  Vector projectionMat() const;
+  const Vector& projectionMat() const;
 
   std::vector<double> p() const;
-  Vector pMat() const;
+  const Vector& pMat() const;
 
   std::vector<double> variance() const;
-  Vector varianceMat() const;
+  const Vector& varianceMat() const;
 
   std::vector<double> var() const;
-  Vector varMat() const;
+  const Vector& varMat() const;
+
+  // Evidence of the equivalent Dirichlet PDF, infinite for dogmatic opinions.
+  std::vector<double> evidence() const;
+  const Vector& evidenceMat() const;
 
   double uncertaintyMaximum() const;
 
@@ -137,17 +338,94 @@ public:
   Eigen::Index dim() const;
 
 protected:
+  friend struct detail::OpinionAccess;
+
   OpinionOwner m_owner;
+  // True if the base rate vector was allocated as mutable by this opinion or the copy it stems
+  // from. Handles from elsewhere may point to const vectors and are copied before writing.
+  bool m_owns_base_rate = false;
 
   Vector m_belief;
   double m_uncertainty;
-  Vector m_base_rate;
+  BaseRateHandle m_base_rate;
 
   double m_prior_weight;
 
   Eigen::Index m_dim = -1;
+
+  // Drops the cached projection, variance and evidence, must be called on every modification.
+  void invalidateCache();
+
+private:
+  detail::OpinionCache m_cache;
+
+  // Base rate for writing, copied first if it is shared with other opinions or the registry or
+  // not owned by the opinion.
+  Vector& mutableBaseRate();
 };
 
+namespace detail {
+
+// Direct access to the storage of an opinion, used by kernels reading their inputs and writing
+// their results in place.
+struct OpinionAccess
+{
+  static const MultinomialOpinion::Vector& belief(const MultinomialOpinion& opinion)
+  {
+    return opinion.m_belief;
+  }
+
+  static MultinomialOpinion::Vector& belief(MultinomialOpinion& opinion)
+  {
+    opinion.invalidateCache();
+    return opinion.m_belief;
+  }
+
+  static const MultinomialOpinion::Vector& baseRate(const MultinomialOpinion& opinion)
+  {
+    return *opinion.m_base_rate;
+  }
+
+  static MultinomialOpinion::Vector& baseRate(MultinomialOpinion& opinion)
+  {
+    return opinion.mutableBaseRate();
+  }
+
+  static const BaseRateHandle& baseRateHandle(const MultinomialOpinion& opinion)
+  {
+    return opinion.m_base_rate;
+  }
+
+  // Shares the base rate without checking its dimension.
+  static void shareBaseRate(MultinomialOpinion& opinion, const BaseRateHandle& base_rate)
+  {
+    opinion.invalidateCache();
+    opinion.m_base_rate      = base_rate;
+    opinion.m_owns_base_rate = false;
+  }
+
+  // Resizes the opinion to the given dimension, keeping the values only if it already has it.
+  static void resize(MultinomialOpinion& opinion, const Eigen::Index& dimensions)
+  {
+    if (opinion.m_dim == dimensions)
+    {
+      return;
+    }
+    opinion.invalidateCache();
+    opinion.m_dim          = dimensions;
+    opinion.m_prior_weight = static_cast<double>(dimensions);
+    opinion.m_belief.resize(dimensions);
+    opinion.m_base_rate      = std::make_shared<MultinomialOpinion::Vector>(dimensions);
+    opinion.m_owns_base_rate = true;
+  }
+};
+
+} // namespace detail
+
 } // namespace subj
 
+#ifdef SUBJ_INLINE_ACCESSORS
+#include <subj/MultinomialOpinion.inl>
+#endif
+
 #endif /* SUBJ_MULTINOMIALOPINION_H */
\ No newline at end of file
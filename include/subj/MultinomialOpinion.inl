@@ -0,0 +1,221 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Accessors of MultinomialOpinion, included by its header if SUBJ_INLINE_ACCESSORS is defined and
+// compiled into the library otherwise.
+
+#ifndef SUBJ_MULTINOMIALOPINION_INL
+#define SUBJ_MULTINOMIALOPINION_INL
+
+#include <limits>
+#include <vector>
+
+namespace subj {
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::belief() const
+{
+  return std::vector<double>(m_belief.data(), m_belief.data() + m_belief.size());
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::beliefMat() const
+{
+  return m_belief;
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::b() const
+{
+  return belief();
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::bMat() const
+{
+  return beliefMat();
+}
+
+SUBJ_INLINE bool MultinomialOpinion::updateUncertainty(const double& uncertainty)
+{
+  invalidateCache();
+  double sum = m_belief.sum();
+
+  if ((sum + uncertainty) == 1)
+  {
+    m_uncertainty = uncertainty;
+  }
+  else
+  {
+    m_uncertainty = 1 - m_belief.sum();
+  }
+
+  return true;
+}
+
+SUBJ_INLINE bool MultinomialOpinion::u(const double& uncertainty)
+{
+  return updateUncertainty(uncertainty);
+}
+
+SUBJ_INLINE double MultinomialOpinion::uncertainty() const
+{
+  return m_uncertainty;
+}
+
+SUBJ_INLINE double MultinomialOpinion::u() const
+{
+  return uncertainty();
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::baseRate() const
+{
+  return std::vector<double>(m_base_rate->data(), m_base_rate->data() + m_base_rate->size());
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::baseRateMat() const
+{
+  return *m_base_rate;
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::a() const
+{
+  return baseRate();
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::aMat() const
+{
+  return baseRateMat();
+}
+
+SUBJ_INLINE const BaseRateHandle& MultinomialOpinion::baseRateHandle() const
+{
+  return m_base_rate;
+}
+
+SUBJ_INLINE bool MultinomialOpinion::sharesBaseRate(const MultinomialOpinion& other) const
+{
+  return m_base_rate == other.m_base_rate;
+}
+
+SUBJ_INLINE OpinionOwner MultinomialOpinion::owner() const
+{
+  return m_owner;
+}
+
+SUBJ_INLINE void MultinomialOpinion::updateOwner(const OpinionOwner& owner)
+{
+  m_owner = owner;
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::projection() const
+{
+  const MultinomialOpinion::Vector& projMat = projectionMat();
+  return std::vector<double>(projMat.data(), projMat.data() + projMat.size());
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::projectionMat() const
+{
+  return m_cache.get(detail::OpinionCache::PROJECTION, [this](Vector& projection) {
+    projection = m_belief + (*m_base_rate * m_uncertainty);
+  });
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::p() const
+{
+  return projection();
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::pMat() const
+{
+  return projectionMat();
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::variance() const
+{
+  const MultinomialOpinion::Vector& varMat = varianceMat();
+  return std::vector<double>(varMat.data(), varMat.data() + varMat.size());
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::varianceMat() const
+{
+  return m_cache.get(detail::OpinionCache::VARIANCE, [this](Vector& variance) {
+    const MultinomialOpinion::Vector& p = projectionMat();
+    variance = (p.array() * (1 - p.array()) * m_uncertainty) / (m_prior_weight * m_uncertainty);
+  });
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::var() const
+{
+  return variance();
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::varMat() const
+{
+  return varianceMat();
+}
+
+SUBJ_INLINE std::vector<double> MultinomialOpinion::evidence() const
+{
+  const MultinomialOpinion::Vector& evidMat = evidenceMat();
+  return std::vector<double>(evidMat.data(), evidMat.data() + evidMat.size());
+}
+
+SUBJ_INLINE const MultinomialOpinion::Vector& MultinomialOpinion::evidenceMat() const
+{
+  return m_cache.get(detail::OpinionCache::EVIDENCE, [this](Vector& evidence) {
+    if (m_uncertainty != 0)
+    {
+      evidence = (m_prior_weight * m_belief) / m_uncertainty;
+      // TODO assertion 1 = m_uncertainty + m_belief.sum();
+    }
+    else
+    {
+      evidence = m_belief * std::numeric_limits<double>::infinity();
+      // TODO assertion 1 = m_belief.sum();
+    }
+  });
+}
+
+SUBJ_INLINE Eigen::Index MultinomialOpinion::dim() const
+{
+  return m_dim;
+}
+
+SUBJ_INLINE void MultinomialOpinion::invalidateCache()
+{
+  m_cache.invalidate();
+}
+
+} // namespace subj
+
+#endif /* SUBJ_MULTINOMIALOPINION_INL */
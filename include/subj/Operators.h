@@ -38,6 +38,7 @@
 #define SUBJ_OPERATORS_H_INCLUDED
 
 #include <subj/subj.h>
+#include <subj/Workspace.h>
 
 #include <Eigen/Dense>
 #include <vector>
@@ -60,6 +61,11 @@ MultinomialOpinion averagingBeliefFusion(const std::vector<MultinomialOpinion>&
 
 MultinomialOpinion abf(const std::vector<MultinomialOpinion>& opinions);
 
+MultinomialOpinion averagingBeliefFusion(const MultinomialOpinion& opinion_a,
+                                         const MultinomialOpinion& opinion_b);
+
+MultinomialOpinion abf(const MultinomialOpinion& opinion_a, const MultinomialOpinion& opinion_b);
+
 MultinomialOpinion aleatoryCumulativeBeliefFusion(const std::vector<MultinomialOpinion>& opinions);
 
 MultinomialOpinion aleatoryCumulativeBeliefFusion(const MultinomialOpinion& opinion_a,
@@ -69,6 +75,24 @@ MultinomialOpinion cbf(const std::vector<MultinomialOpinion>& opinions);
 
 MultinomialOpinion cbf(const MultinomialOpinion& opinion_a, const MultinomialOpinion& opinion_b);
 
+MultinomialOpinion weightedBeliefFusion(const MultinomialOpinion& opinion_a,
+                                        const MultinomialOpinion& opinion_b);
+
+MultinomialOpinion wbf(const MultinomialOpinion& opinion_a, const MultinomialOpinion& opinion_b);
+
+MultinomialOpinion weightedBeliefFusion(const std::vector<MultinomialOpinion>& opinions);
+
+MultinomialOpinion wbf(const std::vector<MultinomialOpinion>& opinions);
+
+MultinomialOpinion consensusAndCompromiseFusion(const std::vector<MultinomialOpinion>& opinions);
+
+MultinomialOpinion ccf(const std::vector<MultinomialOpinion>& opinions);
+
+// Throws std::runtime_error if the opinions are totally conflicting.
+MultinomialOpinion beliefConstraintFusion(const std::vector<MultinomialOpinion>& opinions);
+
+MultinomialOpinion bcf(const std::vector<MultinomialOpinion>& opinions);
+
 MultinomialOpinion cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
                                       const MultinomialOpinion& opinion,
                                       const Eigen::VectorXd& base_rate);
@@ -78,10 +102,78 @@ MultinomialOpinion trustDiscounting(const MultinomialOpinion& opinion,
 
 MultinomialOpinion td(const MultinomialOpinion& opinion, const double& discount_probability);
 
+// Fuses the opinions, each trust discounted by its discount probability, with the given fusion
+// operator. Equal to trustDiscounting() of every opinion followed by the fusion, but computed in
+// one pass without materializing the discounted opinions.
+MultinomialOpinion discountAndFuse(const std::vector<MultinomialOpinion>& opinions,
+                                   const std::vector<double>& discount_probabilities,
+                                   FusionMode mode = FusionMode::CUMULATIVE);
+
+// Closed-form two-opinion operators writing into a caller provided result, which may be one of
+// the inputs. They do not allocate unless the result has a different dimension than the inputs.
+void averagingBeliefFusion(const MultinomialOpinion& opinion_a,
+                           const MultinomialOpinion& opinion_b,
+                           MultinomialOpinion& result);
+
+void abf(const MultinomialOpinion& opinion_a,
+         const MultinomialOpinion& opinion_b,
+         MultinomialOpinion& result);
+
+void aleatoryCumulativeBeliefFusion(const MultinomialOpinion& opinion_a,
+                                    const MultinomialOpinion& opinion_b,
+                                    MultinomialOpinion& result);
+
+void cbf(const MultinomialOpinion& opinion_a,
+         const MultinomialOpinion& opinion_b,
+         MultinomialOpinion& result);
+
+void weightedBeliefFusion(const MultinomialOpinion& opinion_a,
+                          const MultinomialOpinion& opinion_b,
+                          MultinomialOpinion& result);
+
+void wbf(const MultinomialOpinion& opinion_a,
+         const MultinomialOpinion& opinion_b,
+         MultinomialOpinion& result);
+
+void cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
+                        const MultinomialOpinion& opinion,
+                        const Eigen::VectorXd& base_rate,
+                        MultinomialOpinion& result);
+
+void trustDiscounting(const MultinomialOpinion& opinion,
+                      const double& discount_probability,
+                      MultinomialOpinion& result);
+
+void td(const MultinomialOpinion& opinion,
+        const double& discount_probability,
+        MultinomialOpinion& result);
+
 MultinomialOpinion normalMultiplication(const MultinomialOpinion& a, const MultinomialOpinion& b);
 
 MultinomialOpinion deduction(const MultinomialOpinion& opinion, const std::vector<MultinomialOpinion>& conditionalOpinions);
 
+// Operators writing into a caller provided result, which may be one of the inputs, and taking
+// their temporaries from the workspace. Once the workspace has grown to the size of the
+// evaluation and the result has its dimension and an own base rate, they do not allocate.
+void fuse(FusionMode mode,
+          const std::vector<MultinomialOpinion>& opinions,
+          MultinomialOpinion& result,
+          Workspace& workspace = Workspace::local());
+
+void normalMultiplication(const MultinomialOpinion& a,
+                          const MultinomialOpinion& b,
+                          MultinomialOpinion& result,
+                          Workspace& workspace = Workspace::local());
+
+void deduction(const MultinomialOpinion& opinion,
+               const std::vector<MultinomialOpinion>& conditionalOpinions,
+               MultinomialOpinion& result,
+               Workspace& workspace = Workspace::local());
+
 } // namespace subj
 
+#ifdef SUBJ_INLINE_ACCESSORS
+#include <subj/Operators.inl>
+#endif
+
 #endif /* SUBJ_OPERATORS_H_INCLUDED */
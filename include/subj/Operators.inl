@@ -0,0 +1,165 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Measures, trust discounting and the short aliases of the operators, included by their header if
+// SUBJ_INLINE_ACCESSORS is defined and compiled into the library otherwise.
+
+#ifndef SUBJ_OPERATORS_INL
+#define SUBJ_OPERATORS_INL
+
+namespace subj {
+
+SUBJ_INLINE double projectedDistance(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return (a.projectionMat() - b.projectionMat()).cwiseAbs().sum() / 2.0;
+}
+
+SUBJ_INLINE double pd(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return projectedDistance(a, b);
+}
+
+SUBJ_INLINE double conjunctiveCertainty(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return (1.0 - a.uncertainty()) * (1.0 - b.uncertainty());
+}
+
+SUBJ_INLINE double cc(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return conjunctiveCertainty(a, b);
+}
+
+SUBJ_INLINE double degreeOfConflict(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return projectedDistance(a, b) * conjunctiveCertainty(a, b);
+}
+
+SUBJ_INLINE double doc(const MultinomialOpinion& a, const MultinomialOpinion& b)
+{
+  return degreeOfConflict(a, b);
+}
+
+SUBJ_INLINE MultinomialOpinion abf(const std::vector<MultinomialOpinion>& opinions)
+{
+  return averagingBeliefFusion(opinions);
+}
+
+SUBJ_INLINE MultinomialOpinion abf(const MultinomialOpinion& opinion_a,
+                                   const MultinomialOpinion& opinion_b)
+{
+  return averagingBeliefFusion(opinion_a, opinion_b);
+}
+
+SUBJ_INLINE MultinomialOpinion cbf(const std::vector<MultinomialOpinion>& opinions)
+{
+  return aleatoryCumulativeBeliefFusion(opinions);
+}
+
+SUBJ_INLINE MultinomialOpinion cbf(const MultinomialOpinion& opinion_a,
+                                   const MultinomialOpinion& opinion_b)
+{
+  return aleatoryCumulativeBeliefFusion(opinion_a, opinion_b);
+}
+
+SUBJ_INLINE MultinomialOpinion wbf(const MultinomialOpinion& opinion_a,
+                                   const MultinomialOpinion& opinion_b)
+{
+  return weightedBeliefFusion(opinion_a, opinion_b);
+}
+
+SUBJ_INLINE MultinomialOpinion wbf(const std::vector<MultinomialOpinion>& opinions)
+{
+  return weightedBeliefFusion(opinions);
+}
+
+SUBJ_INLINE MultinomialOpinion ccf(const std::vector<MultinomialOpinion>& opinions)
+{
+  return consensusAndCompromiseFusion(opinions);
+}
+
+SUBJ_INLINE MultinomialOpinion bcf(const std::vector<MultinomialOpinion>& opinions)
+{
+  return beliefConstraintFusion(opinions);
+}
+
+SUBJ_INLINE MultinomialOpinion trustDiscounting(const MultinomialOpinion& opinion,
+                                                const double& discount_probability)
+{
+  MultinomialOpinion op(opinion.dim());
+  detail::OpinionAccess::belief(op) = opinion.bMat() * discount_probability;
+  op.u(1 - discount_probability * opinion.bMat().sum());
+  op.updateBaseRate(opinion.baseRateHandle());
+
+  return op;
+}
+
+SUBJ_INLINE MultinomialOpinion td(const MultinomialOpinion& opinion,
+                                  const double& discount_probability)
+{
+  return trustDiscounting(opinion, discount_probability);
+}
+
+SUBJ_INLINE void abf(const MultinomialOpinion& opinion_a,
+                     const MultinomialOpinion& opinion_b,
+                     MultinomialOpinion& result)
+{
+  averagingBeliefFusion(opinion_a, opinion_b, result);
+}
+
+SUBJ_INLINE void cbf(const MultinomialOpinion& opinion_a,
+                     const MultinomialOpinion& opinion_b,
+                     MultinomialOpinion& result)
+{
+  aleatoryCumulativeBeliefFusion(opinion_a, opinion_b, result);
+}
+
+SUBJ_INLINE void wbf(const MultinomialOpinion& opinion_a,
+                     const MultinomialOpinion& opinion_b,
+                     MultinomialOpinion& result)
+{
+  weightedBeliefFusion(opinion_a, opinion_b, result);
+}
+
+SUBJ_INLINE void td(const MultinomialOpinion& opinion,
+                    const double& discount_probability,
+                    MultinomialOpinion& result)
+{
+  trustDiscounting(opinion, discount_probability, result);
+}
+
+} // namespace subj
+
+#endif /* SUBJ_OPERATORS_INL */
@@ -0,0 +1,108 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_OPINION_BUFFER_H_INCLUDED
+#define SUBJ_OPINION_BUFFER_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace subj {
+
+// Header of the binary opinion layout. It is followed by the belief column (count x dim doubles,
+// one opinion per row), the uncertainty column (count doubles), the base rate column (count x dim
+// doubles) and the owner column (count OpinionOwner ids). All offsets are in bytes from the start
+// of the header and 64-byte aligned.
+struct OpinionBufferHeader
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t reserved;
+  uint64_t count;
+  uint64_t dim;
+  uint64_t belief_offset;
+  uint64_t uncertainty_offset;
+  uint64_t base_rate_offset;
+  uint64_t owner_offset;
+  uint64_t size;
+};
+
+static_assert(sizeof(OpinionBufferHeader) == 72, "Opinion buffer header must be 72 bytes");
+
+// Contiguous binary representation of opinions with the same dimension.
+class OpinionBuffer
+{
+public:
+  static const uint32_t VERSION         = 2;
+  static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+  static const size_t ALIGNMENT         = 64;
+
+  OpinionBuffer();
+  OpinionBuffer(const std::vector<MultinomialOpinion>& opinions);
+  OpinionBuffer(const char* data, size_t size);
+
+  std::vector<MultinomialOpinion> opinions() const;
+
+  size_t count() const;
+
+  Eigen::Index dim() const;
+
+  const char* data() const;
+
+  size_t size() const;
+
+  // Checks the header of the given bytes and returns it. Throws std::invalid_argument if the bytes
+  // do not hold a compatible opinion buffer.
+  static OpinionBufferHeader header(const char* data, size_t size);
+
+  // Layout of a buffer holding count opinions of dimension dim. Throws std::invalid_argument if
+  // such a buffer exceeds the addressable memory.
+  static OpinionBufferHeader layout(uint64_t count, uint64_t dim);
+
+private:
+  std::vector<char> m_data;
+};
+
+std::vector<MultinomialOpinion> opinionsFromBytes(const char* data, size_t size);
+
+} // namespace subj
+
+#endif /* SUBJ_OPINION_BUFFER_H_INCLUDED */
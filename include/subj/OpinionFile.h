@@ -0,0 +1,108 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_OPINION_FILE_H_INCLUDED
+#define SUBJ_OPINION_FILE_H_INCLUDED
+
+#include <subj/Batch.h>
+#include <subj/MultinomialOpinion.h>
+#include <subj/OpinionBuffer.h>
+#include <subj/OwnerRegistry.h>
+
+#include <Eigen/Dense>
+#include <string>
+#include <vector>
+
+namespace subj {
+
+// Opinion files use the layout of OpinionBuffer: a versioned header followed by 64-byte aligned
+// belief, uncertainty, base rate and owner columns.
+void writeOpinionFile(const std::string& path, const std::vector<MultinomialOpinion>& opinions);
+
+// Writes a batch of opinions, all of them with the anonymous owner.
+void writeOpinionFile(const std::string& path,
+                      const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate);
+
+void writeOpinionFile(const std::string& path,
+                      const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const OwnerVector>& owners);
+
+// Read-only memory mapping of an opinion file. The columns are accessed in place, without copying
+// or parsing, and stay valid as long as the mapping exists.
+class MappedOpinionFile
+{
+public:
+  using BatchMatrixMap = Eigen::Map<const BatchMatrix, Eigen::Aligned64>;
+  using BatchVectorMap = Eigen::Map<const BatchVector, Eigen::Aligned64>;
+  using OwnerVectorMap = Eigen::Map<const OwnerVector, Eigen::Aligned64>;
+
+  MappedOpinionFile(const std::string& path);
+  MappedOpinionFile(const MappedOpinionFile&) = delete;
+  MappedOpinionFile(MappedOpinionFile&& other);
+  ~MappedOpinionFile();
+
+  MappedOpinionFile& operator=(const MappedOpinionFile&) = delete;
+  MappedOpinionFile& operator=(MappedOpinionFile&& other);
+
+  size_t count() const;
+
+  Eigen::Index dim() const;
+
+  BatchMatrixMap belief() const;
+
+  BatchVectorMap uncertainty() const;
+
+  BatchMatrixMap baseRate() const;
+
+  OwnerVectorMap owners() const;
+
+  MultinomialOpinion opinion(size_t index) const;
+
+  std::vector<MultinomialOpinion> opinions(size_t begin, size_t end) const;
+
+private:
+  const char* m_data = nullptr;
+  size_t m_size      = 0;
+  OpinionBufferHeader m_header;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_OPINION_FILE_H_INCLUDED */
@@ -0,0 +1,130 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_OPINION_GRAPH_H_INCLUDED
+#define SUBJ_OPINION_GRAPH_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace subj {
+
+// Dataflow graph of derived opinions. Input nodes hold given opinions, all other nodes apply one
+// of the operators to the values of earlier nodes, so the graph is acyclic by construction.
+// Changing an input or a discount probability marks the nodes depending on it dirty; update()
+// recomputes only those, level by level, evaluating the independent nodes of a level in parallel.
+// The graph itself is not thread-safe.
+class OpinionGraph
+{
+public:
+  using NodeId = size_t;
+
+  enum class Operation
+  {
+    INPUT,
+    CUMULATIVE_FUSION,
+    AVERAGING_FUSION,
+    TRUST_DISCOUNTING,
+    DEDUCTION,
+    NORMAL_MULTIPLICATION
+  };
+
+  NodeId addInput(const MultinomialOpinion& opinion);
+
+  // aleatoryCumulativeBeliefFusion of the input nodes.
+  NodeId addCumulativeFusion(const std::vector<NodeId>& inputs);
+
+  // averagingBeliefFusion of the input nodes.
+  NodeId addAveragingFusion(const std::vector<NodeId>& inputs);
+
+  // trustDiscounting of the input node with the given probability.
+  NodeId addTrustDiscounting(const NodeId& input, const double& discount_probability);
+
+  // deduction of the opinion node through the conditional opinion nodes.
+  NodeId addDeduction(const NodeId& opinion, const std::vector<NodeId>& conditionals);
+
+  // normalMultiplication of the two nodes.
+  NodeId addNormalMultiplication(const NodeId& a, const NodeId& b);
+
+  // Replaces the opinion of an input node and marks its dependents dirty.
+  void setInput(const NodeId& node, const MultinomialOpinion& opinion);
+
+  // Replaces the probability of a trust discounting node and marks it and its dependents dirty.
+  void setDiscountProbability(const NodeId& node, const double& discount_probability);
+
+  // Recomputes all dirty nodes. Returns the number of recomputed nodes.
+  size_t update();
+
+  // Value of the node, calls update() first if any node is dirty.
+  const MultinomialOpinion& value(const NodeId& node);
+
+  bool dirty(const NodeId& node) const;
+
+  Operation operation(const NodeId& node) const;
+
+  const std::vector<NodeId>& inputs(const NodeId& node) const;
+
+  size_t size() const;
+
+private:
+  struct Node
+  {
+    Operation operation;
+    std::vector<NodeId> inputs;
+    std::vector<NodeId> dependents;
+    double discount_probability;
+    size_t level;
+    bool dirty;
+    MultinomialOpinion value;
+  };
+
+  NodeId addNode(const Operation& operation,
+                 const std::vector<NodeId>& inputs,
+                 const double& discount_probability = 1.0);
+  MultinomialOpinion evaluate(const Node& node) const;
+  void markDependentsDirty(const NodeId& node);
+  void checkNode(const NodeId& node) const;
+
+  std::vector<Node> m_nodes;
+  std::vector<NodeId> m_dirty;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_OPINION_GRAPH_H_INCLUDED */
@@ -0,0 +1,125 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_OPINION_INDEX_H_INCLUDED
+#define SUBJ_OPINION_INDEX_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace subj {
+
+// Collection of opinions by key with ordered indexes on the projected probability of every
+// category and on the uncertainty. Updates keep the indexes current in O(dim * log n), top-k
+// queries take O(log n + k) and range queries O(log n + number of results). Not thread-safe.
+class OpinionIndex
+{
+public:
+  OpinionIndex() = delete;
+  OpinionIndex(const Eigen::Index& dimensions);
+
+  // Inserts the opinion or replaces the one stored for the key. Throws std::invalid_argument if
+  // the dimension of the opinion does not match the collection.
+  void put(const std::string& key, const MultinomialOpinion& opinion);
+
+  bool erase(const std::string& key);
+
+  // Returns the stored opinion, throws std::out_of_range if the key is not present.
+  const MultinomialOpinion& get(const std::string& key) const;
+
+  bool contains(const std::string& key) const;
+
+  size_t size() const;
+
+  Eigen::Index dim() const;
+
+  // Keys of the k opinions with the highest projected probability of the category, highest first.
+  std::vector<std::string> topProjection(const Eigen::Index& category, size_t k) const;
+
+  // Keys of the k opinions with the lowest projected probability of the category, lowest first.
+  std::vector<std::string> bottomProjection(const Eigen::Index& category, size_t k) const;
+
+  // Keys of the opinions whose projected probability of the category is in [low, high], in
+  // ascending order.
+  std::vector<std::string> projectionRange(const Eigen::Index& category,
+                                           const double& low,
+                                           const double& high) const;
+
+  // Keys of the k most uncertain opinions, most uncertain first.
+  std::vector<std::string> topUncertainty(size_t k) const;
+
+  // Keys of the k least uncertain opinions, least uncertain first.
+  std::vector<std::string> bottomUncertainty(size_t k) const;
+
+  // Keys of the opinions whose uncertainty is in [low, high], in ascending order.
+  std::vector<std::string> uncertaintyRange(const double& low, const double& high) const;
+
+private:
+  using Index = std::set<std::pair<double, size_t> >;
+
+  struct Entry
+  {
+    std::string key;
+    MultinomialOpinion opinion;
+    MultinomialOpinion::Vector projection;
+  };
+
+  void indexEntry(size_t slot);
+  void unindexEntry(size_t slot);
+  const Index& projectionIndex(const Eigen::Index& category) const;
+
+  std::vector<std::string> top(const Index& index, size_t k) const;
+  std::vector<std::string> bottom(const Index& index, size_t k) const;
+  std::vector<std::string> range(const Index& index, const double& low, const double& high) const;
+
+  Eigen::Index m_dim;
+  std::unordered_map<std::string, size_t> m_slots;
+  std::vector<Entry> m_entries;
+  std::vector<size_t> m_free_slots;
+  std::vector<Index> m_projection_indexes;
+  Index m_uncertainty_index;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_OPINION_INDEX_H_INCLUDED */
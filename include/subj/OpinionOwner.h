@@ -37,12 +37,31 @@
 #ifndef SUBJ_OPINION_OWNER_H
 #define SUBJ_OPINION_OWNER_H
 
+#include <cstdint>
+
 namespace subj {
 
+// Compact handle of the owner of an opinion, interned by an OwnerRegistry. Id 0 is the anonymous
+// owner every opinion starts with.
 class OpinionOwner
 {
 public:
+  using Id = uint32_t;
+
+  static const Id ANONYMOUS = 0;
+
   OpinionOwner();
+  explicit OpinionOwner(const Id& id);
+
+  Id id() const;
+
+  bool anonymous() const;
+
+  bool operator==(const OpinionOwner& other) const;
+  bool operator!=(const OpinionOwner& other) const;
+
+private:
+  Id m_id;
 };
 
 } // namespace subj
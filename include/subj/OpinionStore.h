@@ -0,0 +1,112 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_OPINION_STORE_H_INCLUDED
+#define SUBJ_OPINION_STORE_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace subj {
+
+// Thread-safe map from entity id to opinion. Keys are distributed over independently locked
+// shards, each padded to its own cache lines, so threads updating different entities rarely
+// contend. Every operation on a key is atomic with respect to all other operations on that key.
+class OpinionStore
+{
+public:
+  static const size_t DEFAULT_SHARD_COUNT = 64;
+
+  // The shard count is rounded up to the next power of two.
+  OpinionStore(size_t shard_count = DEFAULT_SHARD_COUNT);
+  OpinionStore(const OpinionStore&) = delete;
+
+  OpinionStore& operator=(const OpinionStore&) = delete;
+
+  // Stores the opinion, replacing a previous one.
+  void put(const std::string& key, const MultinomialOpinion& opinion);
+
+  // Fuses the opinion into the stored one by aleatory cumulative belief fusion. Stores the opinion
+  // if the key is not present yet. Returns the fused opinion.
+  MultinomialOpinion fuseIn(const std::string& key, const MultinomialOpinion& opinion);
+
+  // Applies trust discounting with the given probability to the stored opinion. Returns false if
+  // the key is not present.
+  bool discount(const std::string& key, const double& discount_probability);
+
+  // Returns the stored opinion, throws std::out_of_range if the key is not present.
+  MultinomialOpinion get(const std::string& key) const;
+
+  // Copies the stored opinion into opinion. Returns false if the key is not present.
+  bool get(const std::string& key, MultinomialOpinion& opinion) const;
+
+  bool contains(const std::string& key) const;
+
+  bool erase(const std::string& key);
+
+  // Number of stored opinions. Not a snapshot while other threads modify the store.
+  size_t size() const;
+
+  size_t shardCount() const;
+
+  std::vector<std::string> keys() const;
+
+private:
+  struct Shard
+  {
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, MultinomialOpinion> opinions;
+    // Keeps the mutexes of neighbouring shards off a shared cache line
+    char padding[64];
+  };
+
+  Shard& shard(const std::string& key);
+  const Shard& shard(const std::string& key) const;
+
+  std::unique_ptr<Shard[]> m_shards;
+  size_t m_shard_count;
+  unsigned m_shard_shift;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_OPINION_STORE_H_INCLUDED */
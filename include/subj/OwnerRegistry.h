@@ -0,0 +1,117 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_OWNER_REGISTRY_H_INCLUDED
+#define SUBJ_OWNER_REGISTRY_H_INCLUDED
+
+#include <subj/Batch.h>
+#include <subj/MultinomialOpinion.h>
+#include <subj/OpinionOwner.h>
+
+#include <Eigen/Dense>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace subj {
+
+// Owner ids of a batch of opinions, one per row.
+using OwnerVector = Eigen::Matrix<OpinionOwner::Id, Eigen::Dynamic, 1>;
+
+// Interns owner names into dense ids, starting at 1 after the anonymous owner. Thread-safe.
+class OwnerRegistry
+{
+public:
+  OwnerRegistry();
+  OwnerRegistry(const OwnerRegistry&) = delete;
+
+  OwnerRegistry& operator=(const OwnerRegistry&) = delete;
+
+  // Returns the owner of the given name, registering it if it is not known yet.
+  OpinionOwner intern(const std::string& name);
+
+  // Returns false if no owner of the given name is registered.
+  bool find(const std::string& name, OpinionOwner& owner) const;
+
+  // Name of the owner, empty for the anonymous owner. Throws std::out_of_range for unknown ids.
+  std::string name(const OpinionOwner& owner) const;
+
+  // Number of ids in use, including the anonymous owner.
+  size_t size() const;
+
+private:
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, OpinionOwner::Id> m_ids;
+  std::vector<std::string> m_names;
+};
+
+// Dense table of the trust, as discount probability, in every owner. Owners without an entry are
+// trusted with the default probability.
+class OwnerTrust
+{
+public:
+  OwnerTrust(const double& default_probability = 1.0);
+
+  void setTrust(const OpinionOwner& owner, const double& discount_probability);
+
+  double trust(const OpinionOwner& owner) const;
+
+  double defaultTrust() const;
+
+  // Discount probabilities indexed by owner id, owners past the end use the default.
+  const BatchVector& trustTable() const;
+
+private:
+  double m_default;
+  BatchVector m_trust;
+};
+
+// Discounts every opinion by the trust in its owner, keeping the owner.
+std::vector<MultinomialOpinion> ownerTrustDiscounting(
+  const std::vector<MultinomialOpinion>& opinions, const OwnerTrust& trust);
+
+// Discounts every opinion of the batch by the trust in the owner of its row in one pass.
+OpinionBatch batchOwnerTrustDiscounting(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate,
+                                        const Eigen::Ref<const OwnerVector>& owners,
+                                        const OwnerTrust& trust);
+
+} // namespace subj
+
+#endif /* SUBJ_OWNER_REGISTRY_H_INCLUDED */
@@ -0,0 +1,182 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_SPARSE_OPINION_H_INCLUDED
+#define SUBJ_SPARSE_OPINION_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace subj {
+
+namespace detail {
+struct SparseOpinionAccess;
+}
+
+// (category, value) pair of a sparse belief or base rate.
+using SparseEntry = std::pair<Eigen::Index, double>;
+
+// Base rate over a large domain, where every category has the same default base rate except for a
+// few explicitly given ones. The default is chosen such that the base rate sums up to 1. Base
+// rates are immutable and shared between opinions.
+class SparseBaseRate
+{
+public:
+  SparseBaseRate() = delete;
+  // Uniform base rate.
+  explicit SparseBaseRate(const Eigen::Index& dimensions);
+  // Throws std::out_of_range for categories outside of the domain and std::invalid_argument for
+  // duplicate categories or exceptions summing up to more than 1.
+  SparseBaseRate(const Eigen::Index& dimensions, const std::vector<SparseEntry>& exceptions);
+
+  double at(const Eigen::Index& category) const;
+
+  double defaultValue() const;
+
+  // Exceptions ordered by category.
+  const std::vector<SparseEntry>& exceptions() const;
+
+  Eigen::Index dim() const;
+
+private:
+  Eigen::Index m_dim;
+  double m_default;
+  std::vector<SparseEntry> m_exceptions;
+};
+
+using SparseBaseRatePtr = std::shared_ptr<const SparseBaseRate>;
+
+// Multinomial opinion over a large domain with belief on only a few categories. Only the non-zero
+// beliefs are stored and all operators on sparse opinions run in the number of non-zero beliefs
+// and base rate exceptions, independent of the dimension.
+class SparseOpinion
+{
+public:
+  SparseOpinion() = delete;
+  // Vacuous opinion with uniform base rate.
+  explicit SparseOpinion(const Eigen::Index& dimensions);
+  // As for MultinomialOpinion, the uncertainty is replaced by 1 - sum(belief) if they do not sum
+  // up to 1. Without base rate the base rate is uniform. Throws std::out_of_range for categories
+  // outside of the domain and std::invalid_argument for duplicate categories or a base rate of a
+  // different dimension.
+  SparseOpinion(const Eigen::Index& dimensions,
+                const std::vector<SparseEntry>& belief,
+                const double& uncertainty,
+                const SparseBaseRatePtr& base_rate = SparseBaseRatePtr());
+  // Keeps the non-zero beliefs, the most frequent base rate becomes the default.
+  explicit SparseOpinion(const MultinomialOpinion& opinion);
+
+  MultinomialOpinion dense() const;
+
+  // Non-zero beliefs ordered by category.
+  const std::vector<SparseEntry>& entries() const;
+
+  double belief(const Eigen::Index& category) const;
+
+  double uncertainty() const;
+  double u() const;
+
+  double baseRate(const Eigen::Index& category) const;
+
+  const SparseBaseRatePtr& sharedBaseRate() const;
+
+  double projection(const Eigen::Index& category) const;
+
+  // Category with the highest projected probability and that probability.
+  SparseEntry mostProbable() const;
+
+  Eigen::Index dim() const;
+
+  size_t nnz() const;
+
+private:
+  // Beliefs must be ordered by category without zeros.
+  SparseOpinion(std::vector<SparseEntry>&& belief,
+                const double& uncertainty,
+                const SparseBaseRatePtr& base_rate);
+
+  void setUncertainty(const double& uncertainty);
+
+  std::vector<SparseEntry> m_belief;
+  double m_uncertainty;
+  SparseBaseRatePtr m_base_rate;
+
+  friend struct detail::SparseOpinionAccess;
+};
+
+double projectedDistance(const SparseOpinion& a, const SparseOpinion& b);
+
+double pd(const SparseOpinion& a, const SparseOpinion& b);
+
+SparseOpinion trustDiscounting(const SparseOpinion& opinion, const double& discount_probability);
+
+SparseOpinion td(const SparseOpinion& opinion, const double& discount_probability);
+
+// The fusion operators follow those of multinomial opinions. The fused base rate is shared with
+// the inputs if all of them share the same base rate.
+SparseOpinion aleatoryCumulativeBeliefFusion(const SparseOpinion& opinion_a,
+                                             const SparseOpinion& opinion_b);
+
+SparseOpinion aleatoryCumulativeBeliefFusion(const std::vector<SparseOpinion>& opinions);
+
+SparseOpinion cbf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b);
+
+SparseOpinion cbf(const std::vector<SparseOpinion>& opinions);
+
+SparseOpinion averagingBeliefFusion(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b);
+
+SparseOpinion averagingBeliefFusion(const std::vector<SparseOpinion>& opinions);
+
+SparseOpinion abf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b);
+
+SparseOpinion abf(const std::vector<SparseOpinion>& opinions);
+
+SparseOpinion weightedBeliefFusion(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b);
+
+SparseOpinion weightedBeliefFusion(const std::vector<SparseOpinion>& opinions);
+
+SparseOpinion wbf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b);
+
+SparseOpinion wbf(const std::vector<SparseOpinion>& opinions);
+
+} // namespace subj
+
+#endif /* SUBJ_SPARSE_OPINION_H_INCLUDED */
@@ -0,0 +1,122 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_SUBJECTIVE_NETWORK_H_INCLUDED
+#define SUBJ_SUBJECTIVE_NETWORK_H_INCLUDED
+
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace subj {
+
+namespace detail {
+struct DeductionState;
+}
+
+// Directed acyclic network of multinomial variables. Root variables hold evidence opinions, every
+// other variable is deduced from the joint opinion of its parents (the normal multiplication of
+// their marginals) through a table of conditional opinions. compile() orders the variables into
+// levels and precomputes the per-variable deduction state, evaluate() computes the marginals of all
+// dirty variables level by level, evaluating the variables of a level in parallel. Changing root
+// evidence only marks the descendants of that root dirty. Not thread-safe.
+class SubjectiveNetwork
+{
+public:
+  using VariableId = size_t;
+
+  SubjectiveNetwork();
+
+  // Adds a variable with the given number of states, which starts as a root with vacuous evidence.
+  VariableId addVariable(const Eigen::Index& dimensions);
+
+  // Makes the variable a child of the given parents. The conditional opinions are indexed by the
+  // joint parent state, with the first parent being the most significant, and have the dimension
+  // of the variable.
+  void setConditionals(const VariableId& variable,
+                       const std::vector<VariableId>& parents,
+                       const std::vector<MultinomialOpinion>& conditionals);
+
+  // Sets the evidence opinion of a root variable.
+  void setEvidence(const VariableId& variable, const MultinomialOpinion& opinion);
+
+  // Orders the variables and precomputes the deduction state. Throws std::invalid_argument if the
+  // network contains a cycle. Called by evaluate() when the structure has changed.
+  void compile();
+
+  // Computes the marginals of all dirty variables. Returns the number of evaluated variables.
+  size_t evaluate();
+
+  // Marginal opinion of the variable, calls evaluate() first.
+  const MultinomialOpinion& marginal(const VariableId& variable);
+
+  const std::vector<VariableId>& parents(const VariableId& variable) const;
+
+  Eigen::Index dim(const VariableId& variable) const;
+
+  bool dirty(const VariableId& variable) const;
+
+  size_t size() const;
+
+private:
+  struct Variable
+  {
+    Eigen::Index dim;
+    std::vector<VariableId> parents;
+    std::vector<VariableId> children;
+    std::vector<MultinomialOpinion> conditionals;
+    std::shared_ptr<detail::DeductionState> deduction;
+    MultinomialOpinion marginal;
+    size_t level;
+    bool dirty;
+  };
+
+  void checkVariable(const VariableId& variable) const;
+  void markDirty(const VariableId& variable);
+  void evaluateVariable(Variable& variable) const;
+
+  std::vector<Variable> m_variables;
+  std::vector<VariableId> m_dirty;
+  bool m_compiled;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_SUBJECTIVE_NETWORK_H_INCLUDED */
@@ -0,0 +1,148 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_TRUST_NETWORK_H_INCLUDED
+#define SUBJ_TRUST_NETWORK_H_INCLUDED
+
+#include <subj/BinomialOpinion.h>
+#include <subj/MultinomialOpinion.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace subj {
+
+// Network of agents connected by binomial trust opinions. The trust an analyst derives in another
+// agent is computed over the layered graph of shortest trust paths from the analyst: the trust in
+// an agent is the cumulative fusion of the trust of all predecessors one hop closer to the analyst,
+// each discounted by the projected derived trust in that predecessor. The derived trust of all
+// agents reachable from an analyst is memoized, so every path prefix is evaluated once. Changing
+// the opinion of an existing edge only re-evaluates the agents downstream of it, adding or
+// removing an edge invalidates the memoized results of the analysts reaching its truster.
+//
+// Queries are pairs (analyst, source): the opinion held by the source, discounted by the derived
+// trust of the analyst in the source. Sources the analyst does not reach are discounted with a
+// probability of 0. The network is not thread-safe, batched queries are evaluated in parallel.
+class TrustNetwork
+{
+public:
+  using AgentId = uint32_t;
+  using Query   = std::pair<AgentId, AgentId>;
+
+  TrustNetwork(const AgentId& agent_count = 0);
+
+  AgentId addAgent();
+
+  AgentId agentCount() const;
+
+  // Sets the trust opinion of the truster in the trustee, replacing a previous one.
+  void setTrust(const AgentId& truster, const AgentId& trustee, const BinomialOpinion& trust);
+
+  bool removeTrust(const AgentId& truster, const AgentId& trustee);
+
+  bool hasTrust(const AgentId& truster, const AgentId& trustee) const;
+
+  // Direct trust of the truster in the trustee, throws std::out_of_range if there is none.
+  BinomialOpinion trust(const AgentId& truster, const AgentId& trustee) const;
+
+  // Sets the functional opinion held by the agent.
+  void setOpinion(const AgentId& agent, const MultinomialOpinion& opinion);
+
+  bool hasOpinion(const AgentId& agent) const;
+
+  // Trust of the analyst in the agent, fused over all shortest trust paths. Vacuous if the agent
+  // is not reachable, dogmatic full trust for the analyst itself.
+  BinomialOpinion derivedTrust(const AgentId& analyst, const AgentId& agent);
+
+  // Opinion of the source discounted by the derived trust of the analyst in it. Throws
+  // std::invalid_argument if the source holds no opinion.
+  MultinomialOpinion discountedOpinion(const AgentId& analyst, const AgentId& source);
+
+  // Evaluates the queries in parallel, see discountedOpinion().
+  std::vector<MultinomialOpinion> discountedOpinions(const std::vector<Query>& queries);
+
+  // Cumulative fusion of the discounted opinions of all sources reachable from the analyst.
+  // Vacuous of the given dimension if there are none.
+  MultinomialOpinion fusedOpinion(const AgentId& analyst, const Eigen::Index& dimensions);
+
+  // Drops all memoized derived trust.
+  void clearCache();
+
+private:
+  struct Trust
+  {
+    double b;
+    double d;
+    double u;
+    double a;
+  };
+
+  struct Edge
+  {
+    AgentId agent;
+    Trust trust;
+  };
+
+  // Derived trust of one analyst in all agents it reaches
+  struct View
+  {
+    std::vector<uint32_t> distance;
+    std::vector<uint32_t> position;
+    std::vector<AgentId> order;
+    std::vector<Trust> trust;
+    bool stale;
+  };
+
+  void checkAgent(const AgentId& agent) const;
+  const View& view(const AgentId& analyst);
+  void computeView(const AgentId& analyst, View& view) const;
+  Trust fuseIncoming(const View& view, const AgentId& agent) const;
+  void propagateEdgeChange(View& view, const AgentId& truster, const AgentId& trustee) const;
+  void invalidateViews(const AgentId& truster);
+  double discountProbability(const View& view, const AgentId& source) const;
+
+  std::vector<std::vector<Edge> > m_outgoing;
+  std::vector<std::vector<Edge> > m_incoming;
+  std::unordered_map<AgentId, MultinomialOpinion> m_opinions;
+  std::unordered_map<AgentId, View> m_views;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_TRUST_NETWORK_H_INCLUDED */
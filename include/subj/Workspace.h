@@ -0,0 +1,132 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_WORKSPACE_H_INCLUDED
+#define SUBJ_WORKSPACE_H_INCLUDED
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <vector>
+
+namespace subj {
+
+// Bump allocator for the temporaries of the operators. Memory is handed out from blocks which are
+// kept when it is released, so once a workspace has grown to the peak size of an evaluation,
+// repeating the evaluation does not touch the global heap. Not thread-safe, every thread uses its
+// own workspace, e.g. local().
+//
+//   Workspace& workspace = Workspace::local();
+//   {
+//     Workspace::Scope scope(workspace);
+//     deduction(x, conditionals, y, workspace);
+//   } // all temporaries of the scope are released here
+class Workspace
+{
+public:
+  static const size_t ALIGNMENT = 64;
+
+  // Releases all memory allocated within its lifetime when it is destroyed. Scopes nest.
+  class Scope
+  {
+  public:
+    explicit Scope(Workspace& workspace);
+    Scope(const Scope&) = delete;
+    ~Scope();
+
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    Workspace& m_workspace;
+    size_t m_block;
+    size_t m_offset;
+    size_t m_used;
+  };
+
+  // Workspace with an initial block of the given number of bytes.
+  explicit Workspace(size_t capacity = 0);
+  // Workspace using the caller provided memory as first block. The memory is not owned and must
+  // outlive the workspace, larger demands are served from the heap.
+  Workspace(void* buffer, size_t size);
+  Workspace(const Workspace&) = delete;
+  ~Workspace();
+
+  Workspace& operator=(const Workspace&) = delete;
+
+  // Uninitialized memory for count doubles, aligned to ALIGNMENT. Throws std::bad_alloc if the
+  // size in bytes is not representable.
+  double* allocate(size_t count);
+
+  // Uninitialized vector and column-major matrix views of workspace memory.
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> vector(Eigen::Index size);
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> matrix(Eigen::Index rows, Eigen::Index cols);
+
+  // Releases all memory. If the workspace had to grow, its heap blocks are merged into one, such
+  // that the next evaluation of the same size is served from a single block. Throws
+  // std::logic_error while a Scope is alive, as the scope would restore a position in freed blocks.
+  void reset();
+
+  // Bytes in use and in all blocks.
+  size_t used() const;
+  size_t capacity() const;
+
+  // Number of blocks allocated from the global heap so far, constant once warmed up.
+  size_t heapAllocations() const;
+
+  // Workspace of the calling thread.
+  static Workspace& local();
+
+private:
+  struct Block
+  {
+    char* memory;
+    char* data;
+    size_t size;
+  };
+
+  void addBlock(size_t size);
+
+  std::vector<Block> m_blocks;
+  size_t m_block;
+  size_t m_offset;
+  size_t m_used;
+  size_t m_heap_allocations;
+  size_t m_scopes;
+};
+
+} // namespace subj
+
+#endif /* SUBJ_WORKSPACE_H_INCLUDED */
@@ -37,10 +37,29 @@
 #ifndef SUBJ_SUBJ_H_INCLUDED
 #define SUBJ_SUBJ_H_INCLUDED
 
+#include <subj/BaseRate.h>
+#include <subj/Batch.h>
 #include <subj/BinomialOpinion.h>
+#include <subj/CompactOpinions.h>
+#include <subj/DecayingOpinion.h>
+#include <subj/Dispatch.h>
+#include <subj/EvidenceIngestion.h>
+#include <subj/Executor.h>
+#include <subj/Expression.h>
+#include <subj/FusionMode.h>
 #include <subj/HyperOpinion.h>
 #include <subj/MultinomialOpinion.h>
 #include <subj/Operators.h>
+#include <subj/OpinionBuffer.h>
+#include <subj/OpinionFile.h>
+#include <subj/OpinionGraph.h>
+#include <subj/OpinionIndex.h>
+#include <subj/OpinionStore.h>
+#include <subj/OwnerRegistry.h>
+#include <subj/SparseOpinion.h>
+#include <subj/SubjectiveNetwork.h>
+#include <subj/TrustNetwork.h>
 #include <subj/Version.h>
+#include <subj/Workspace.h>
 
 #endif /* SUBJ_SUBJ_H_INCLUDED */
\ No newline at end of file
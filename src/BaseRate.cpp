@@ -0,0 +1,142 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/BaseRate.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace subj {
+
+namespace {
+
+// Initial number of base rates after which unused ones are purged.
+const size_t INITIAL_PURGE_SIZE = 64;
+
+// Hashes the bits of the values, mixing every value with the finalizer of MurmurHash3.
+uint64_t hashBaseRate(const BaseRateRegistry::Vector& base_rate)
+{
+  uint64_t hash = static_cast<uint64_t>(base_rate.size());
+  for (Eigen::Index i = 0; i < base_rate.size(); ++i)
+  {
+    // Adding zero turns -0.0 into 0.0, which compares equal.
+    double value = base_rate(i) + 0.0;
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    hash ^= bits + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb93fe53fb7a5ULL;
+    hash ^= hash >> 33;
+  }
+  return hash;
+}
+
+} // namespace
+
+BaseRateRegistry::BaseRateRegistry()
+  : m_purge_size(INITIAL_PURGE_SIZE)
+{
+}
+
+BaseRateHandle BaseRateRegistry::intern(const Vector& base_rate)
+{
+  uint64_t hash = hashBaseRate(base_rate);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto range = m_handles.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second->size() == base_rate.size() && *it->second == base_rate)
+    {
+      return it->second;
+    }
+  }
+
+  if (m_handles.size() >= m_purge_size)
+  {
+    purgeLocked();
+    m_purge_size = std::max(INITIAL_PURGE_SIZE, 2 * m_handles.size());
+  }
+  BaseRateHandle handle = std::make_shared<const Vector>(base_rate);
+  m_handles.emplace(hash, handle);
+  return handle;
+}
+
+BaseRateHandle BaseRateRegistry::uniform(const Eigen::Index& dimensions)
+{
+  return intern(Vector::Constant(dimensions, 1.0 / static_cast<double>(dimensions)));
+}
+
+size_t BaseRateRegistry::purge()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return purgeLocked();
+}
+
+size_t BaseRateRegistry::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_handles.size();
+}
+
+BaseRateRegistry& BaseRateRegistry::global()
+{
+  static BaseRateRegistry registry;
+  return registry;
+}
+
+size_t BaseRateRegistry::purgeLocked()
+{
+  size_t purged = 0;
+  for (auto it = m_handles.begin(); it != m_handles.end();)
+  {
+    if (it->second.use_count() == 1)
+    {
+      it = m_handles.erase(it);
+      ++purged;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  return purged;
+}
+
+} // namespace subj
@@ -0,0 +1,658 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/Batch.h>
+
+#include "DeductionKernel.h"
+#include "FusionKernels.h"
+#include "NumericKernels.h"
+#include "Parallel.h"
+
+#include <Eigen/Dense>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+void checkBatch(const Eigen::Ref<const BatchMatrix>& belief,
+                const Eigen::Ref<const BatchVector>& uncertainty,
+                const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  if (belief.rows() != uncertainty.rows() || belief.rows() != base_rate.rows() ||
+      belief.cols() != base_rate.cols())
+  {
+    throw std::invalid_argument("Belief, uncertainty and base rate must describe the same opinions!");
+  }
+}
+
+void checkOffsets(const Eigen::Ref<const SegmentOffsets>& offsets, Eigen::Index rows)
+{
+  if (offsets.rows() < 1 || offsets(0) != 0 || offsets(offsets.rows() - 1) != rows)
+  {
+    throw std::invalid_argument("Segment offsets must start at 0 and end at the number of opinions!");
+  }
+
+  for (Eigen::Index i = 1; i < offsets.rows(); ++i)
+  {
+    if (offsets(i) <= offsets(i - 1))
+    {
+      throw std::invalid_argument("Segment offsets must be strictly increasing!");
+    }
+  }
+}
+
+// Fuses the rows [begin, end) into row 'out' of the result with the kernels shared with the
+// opinion versions of the fusion operators.
+void fuseSegment(FusionMode mode,
+                 const Eigen::Ref<const BatchMatrix>& belief,
+                 const Eigen::Ref<const BatchVector>& uncertainty,
+                 const Eigen::Ref<const BatchMatrix>& base_rate,
+                 Eigen::Index begin,
+                 Eigen::Index end,
+                 OpinionBatch& result,
+                 Eigen::Index out)
+{
+  BatchMatrix& b_res = std::get<0>(result);
+  detail::BatchSpan source(belief, uncertainty, base_rate, begin, end);
+  std::get<1>(result)(out) =
+    detail::fuse(mode, source, b_res.cols(), b_res.row(out), std::get<2>(result).row(out));
+}
+
+OpinionBatch batchFusion(FusionMode mode,
+                         const Eigen::Ref<const BatchMatrix>& belief,
+                         const Eigen::Ref<const BatchVector>& uncertainty,
+                         const Eigen::Ref<const BatchMatrix>& base_rate,
+                         const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  checkBatch(belief, uncertainty, base_rate);
+  checkOffsets(offsets, belief.rows());
+
+  Eigen::Index segments = offsets.rows() - 1;
+  OpinionBatch result(BatchMatrix(segments, belief.cols()),
+                      BatchVector(segments),
+                      BatchMatrix(segments, belief.cols()));
+
+  detail::parallelFor(
+    static_cast<size_t>(segments),
+    [&](size_t begin, size_t end) {
+      for (size_t s = begin; s < end; ++s)
+      {
+        Eigen::Index seg = static_cast<Eigen::Index>(s);
+        fuseSegment(
+          mode, belief, uncertainty, base_rate, offsets(seg), offsets(seg + 1), result, seg);
+      }
+    },
+    detail::PARALLEL_GRAIN_SIZE / 16);
+
+  return result;
+}
+
+void checkLength(Eigen::Index rows, std::initializer_list<Eigen::Index> lengths)
+{
+  for (Eigen::Index length : lengths)
+  {
+    if (length != rows)
+    {
+      throw std::invalid_argument("All binomial arrays must have the same length!");
+    }
+  }
+}
+
+detail::ArrayIn arrayIn(const BatchVectorIn& x)
+{
+  return {x.data(), x.innerStride()};
+}
+
+detail::ArrayOut arrayOut(BatchVectorOut& x)
+{
+  return {x.data(), x.innerStride()};
+}
+
+detail::BinomialArraysIn binomialIn(const BatchVectorIn& b,
+                                    const BatchVectorIn& d,
+                                    const BatchVectorIn& u,
+                                    const BatchVectorIn& a)
+{
+  return {arrayIn(b), arrayIn(d), arrayIn(u), arrayIn(a)};
+}
+
+detail::BinomialArraysOut binomialOut(BatchVectorOut& b,
+                                      BatchVectorOut& d,
+                                      BatchVectorOut& u,
+                                      BatchVectorOut& a)
+{
+  return {arrayOut(b), arrayOut(d), arrayOut(u), arrayOut(a)};
+}
+
+detail::OpinionRows opinionRows(const Eigen::Ref<const BatchMatrix>& belief,
+                                const Eigen::Ref<const BatchVector>& uncertainty,
+                                const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return {belief.data(),
+          belief.outerStride(),
+          uncertainty.data(),
+          base_rate.data(),
+          base_rate.outerStride(),
+          belief.cols()};
+}
+
+SegmentOffsets singleSegment(Eigen::Index rows)
+{
+  SegmentOffsets offsets(2);
+  offsets << 0, rows;
+  return offsets;
+}
+
+} // namespace
+
+OpinionBatch batchAveragingBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate,
+                                        const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchFusion(FusionMode::AVERAGING, belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchAveragingBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchAveragingBeliefFusion(belief, uncertainty, base_rate, singleSegment(belief.rows()));
+}
+
+OpinionBatch batchAbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchAveragingBeliefFusion(belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchAbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchAveragingBeliefFusion(belief, uncertainty, base_rate);
+}
+
+OpinionBatch batchAleatoryCumulativeBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                                 const Eigen::Ref<const BatchVector>& uncertainty,
+                                                 const Eigen::Ref<const BatchMatrix>& base_rate,
+                                                 const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchFusion(FusionMode::CUMULATIVE, belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchAleatoryCumulativeBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                                 const Eigen::Ref<const BatchVector>& uncertainty,
+                                                 const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchAleatoryCumulativeBeliefFusion(
+    belief, uncertainty, base_rate, singleSegment(belief.rows()));
+}
+
+OpinionBatch batchCbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchAleatoryCumulativeBeliefFusion(belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchCbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchAleatoryCumulativeBeliefFusion(belief, uncertainty, base_rate);
+}
+
+OpinionBatch batchWeightedBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                       const Eigen::Ref<const BatchVector>& uncertainty,
+                                       const Eigen::Ref<const BatchMatrix>& base_rate,
+                                       const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchFusion(FusionMode::WEIGHTED, belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchWeightedBeliefFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                       const Eigen::Ref<const BatchVector>& uncertainty,
+                                       const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchWeightedBeliefFusion(belief, uncertainty, base_rate, singleSegment(belief.rows()));
+}
+
+OpinionBatch batchWbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchWeightedBeliefFusion(belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchWbf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchWeightedBeliefFusion(belief, uncertainty, base_rate);
+}
+
+OpinionBatch batchConsensusAndCompromiseFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                               const Eigen::Ref<const BatchVector>& uncertainty,
+                                               const Eigen::Ref<const BatchMatrix>& base_rate,
+                                               const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchFusion(
+    FusionMode::CONSENSUS_AND_COMPROMISE, belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchConsensusAndCompromiseFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                               const Eigen::Ref<const BatchVector>& uncertainty,
+                                               const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchConsensusAndCompromiseFusion(
+    belief, uncertainty, base_rate, singleSegment(belief.rows()));
+}
+
+OpinionBatch batchCcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchConsensusAndCompromiseFusion(belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchCcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchConsensusAndCompromiseFusion(belief, uncertainty, base_rate);
+}
+
+OpinionBatch batchBeliefConstraintFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                         const Eigen::Ref<const BatchVector>& uncertainty,
+                                         const Eigen::Ref<const BatchMatrix>& base_rate,
+                                         const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchFusion(FusionMode::BELIEF_CONSTRAINT, belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchBeliefConstraintFusion(const Eigen::Ref<const BatchMatrix>& belief,
+                                         const Eigen::Ref<const BatchVector>& uncertainty,
+                                         const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchBeliefConstraintFusion(belief, uncertainty, base_rate, singleSegment(belief.rows()));
+}
+
+OpinionBatch batchBcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const SegmentOffsets>& offsets)
+{
+  return batchBeliefConstraintFusion(belief, uncertainty, base_rate, offsets);
+}
+
+OpinionBatch batchBcf(const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  return batchBeliefConstraintFusion(belief, uncertainty, base_rate);
+}
+
+OpinionBatch batchDiscountAndFuse(const Eigen::Ref<const BatchMatrix>& belief,
+                                  const Eigen::Ref<const BatchVector>& uncertainty,
+                                  const Eigen::Ref<const BatchMatrix>& base_rate,
+                                  const Eigen::Ref<const BatchVector>& discount_probability,
+                                  const Eigen::Ref<const SegmentOffsets>& offsets,
+                                  FusionMode mode)
+{
+  checkBatch(belief, uncertainty, base_rate);
+  checkOffsets(offsets, belief.rows());
+  if (discount_probability.rows() != belief.rows() && discount_probability.rows() != 1)
+  {
+    throw std::invalid_argument("One discount probability or one per opinion must be given!");
+  }
+
+  Eigen::Index segments = offsets.rows() - 1;
+  OpinionBatch result(BatchMatrix(segments, belief.cols()),
+                      BatchVector(segments),
+                      BatchMatrix(segments, belief.cols()));
+  BatchMatrix& b_res = std::get<0>(result);
+  BatchVector& u_res = std::get<1>(result);
+  BatchMatrix& a_res = std::get<2>(result);
+  bool shared        = (discount_probability.rows() == 1);
+
+  detail::parallelFor(
+    static_cast<size_t>(segments),
+    [&](size_t begin, size_t end) {
+      for (Eigen::Index seg = begin; seg < static_cast<Eigen::Index>(end); ++seg)
+      {
+        detail::BatchSpan source(belief, uncertainty, base_rate, offsets(seg), offsets(seg + 1));
+        detail::DiscountedSource<detail::BatchSpan> discounted(
+          source, discount_probability.data() + (shared ? 0 : offsets(seg)), shared ? 0 : 1);
+        u_res(seg) =
+          detail::fuse(mode, discounted, belief.cols(), b_res.row(seg), a_res.row(seg));
+      }
+    },
+    detail::PARALLEL_GRAIN_SIZE / 16);
+
+  return result;
+}
+
+OpinionBatch batchDiscountAndFuse(const Eigen::Ref<const BatchMatrix>& belief,
+                                  const Eigen::Ref<const BatchVector>& uncertainty,
+                                  const Eigen::Ref<const BatchMatrix>& base_rate,
+                                  const Eigen::Ref<const BatchVector>& discount_probability,
+                                  FusionMode mode)
+{
+  return batchDiscountAndFuse(
+    belief, uncertainty, base_rate, discount_probability, singleSegment(belief.rows()), mode);
+}
+
+OpinionBatch batchTrustDiscounting(const Eigen::Ref<const BatchMatrix>& belief,
+                                   const Eigen::Ref<const BatchVector>& uncertainty,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate,
+                                   const Eigen::Ref<const BatchVector>& discount_probability)
+{
+  checkBatch(belief, uncertainty, base_rate);
+  if (discount_probability.rows() != belief.rows() && discount_probability.rows() != 1)
+  {
+    throw std::invalid_argument("One discount probability or one per opinion must be given!");
+  }
+
+  OpinionBatch result(
+    BatchMatrix(belief.rows(), belief.cols()), BatchVector(belief.rows()), base_rate);
+  BatchMatrix& b_res = std::get<0>(result);
+  BatchVector& u_res = std::get<1>(result);
+  bool shared        = (discount_probability.rows() == 1);
+
+  detail::parallelFor(static_cast<size_t>(belief.rows()), [&](size_t begin, size_t end) {
+    for (Eigen::Index i = begin; i < static_cast<Eigen::Index>(end); ++i)
+    {
+      double p     = discount_probability(shared ? 0 : i);
+      b_res.row(i) = belief.row(i) * p;
+      u_res(i)     = 1.0 - p * belief.row(i).sum();
+    }
+  });
+
+  return result;
+}
+
+OpinionBatch batchTd(const Eigen::Ref<const BatchMatrix>& belief,
+                     const Eigen::Ref<const BatchVector>& uncertainty,
+                     const Eigen::Ref<const BatchMatrix>& base_rate,
+                     const Eigen::Ref<const BatchVector>& discount_probability)
+{
+  return batchTrustDiscounting(belief, uncertainty, base_rate, discount_probability);
+}
+
+BatchMatrix batchProjection(const Eigen::Ref<const BatchMatrix>& belief,
+                            const Eigen::Ref<const BatchVector>& uncertainty,
+                            const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  checkBatch(belief, uncertainty, base_rate);
+
+  BatchMatrix projection(belief.rows(), belief.cols());
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::OpinionRows x                  = opinionRows(belief, uncertainty, base_rate);
+
+  detail::parallelFor(static_cast<size_t>(belief.rows()), [&](size_t begin, size_t end) {
+    kernels.projection(x, projection.data(), projection.outerStride(), begin, end);
+  });
+
+  return projection;
+}
+
+BatchVector batchProjectedDistance(const Eigen::Ref<const BatchMatrix>& belief_a,
+                                   const Eigen::Ref<const BatchVector>& uncertainty_a,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate_a,
+                                   const Eigen::Ref<const BatchMatrix>& belief_b,
+                                   const Eigen::Ref<const BatchVector>& uncertainty_b,
+                                   const Eigen::Ref<const BatchMatrix>& base_rate_b)
+{
+  checkBatch(belief_a, uncertainty_a, base_rate_a);
+  checkBatch(belief_b, uncertainty_b, base_rate_b);
+  if (belief_a.rows() != belief_b.rows() || belief_a.cols() != belief_b.cols())
+  {
+    throw std::invalid_argument("Both batches must have the same number of opinions and dimensions!");
+  }
+
+  BatchVector distance(belief_a.rows());
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::OpinionRows x                  = opinionRows(belief_a, uncertainty_a, base_rate_a);
+  detail::OpinionRows y                  = opinionRows(belief_b, uncertainty_b, base_rate_b);
+
+  detail::parallelFor(static_cast<size_t>(belief_a.rows()), [&](size_t begin, size_t end) {
+    kernels.projectedDistance(x, y, distance.data(), begin, end);
+  });
+
+  return distance;
+}
+
+BatchVector batchPd(const Eigen::Ref<const BatchMatrix>& belief_a,
+                    const Eigen::Ref<const BatchVector>& uncertainty_a,
+                    const Eigen::Ref<const BatchMatrix>& base_rate_a,
+                    const Eigen::Ref<const BatchMatrix>& belief_b,
+                    const Eigen::Ref<const BatchVector>& uncertainty_b,
+                    const Eigen::Ref<const BatchMatrix>& base_rate_b)
+{
+  return batchProjectedDistance(
+    belief_a, uncertainty_a, base_rate_a, belief_b, uncertainty_b, base_rate_b);
+}
+
+OpinionBatch batchDeduction(const Eigen::Ref<const BatchMatrix>& belief,
+                            const Eigen::Ref<const BatchVector>& uncertainty,
+                            const Eigen::Ref<const BatchMatrix>& base_rate,
+                            const Eigen::Ref<const BatchMatrix>& conditional_belief,
+                            const Eigen::Ref<const BatchVector>& conditional_uncertainty)
+{
+  checkBatch(belief, uncertainty, base_rate);
+  if (conditional_belief.rows() != belief.cols() ||
+      conditional_uncertainty.rows() != belief.cols())
+  {
+    throw std::invalid_argument("One conditional opinion per dimension must be given!");
+  }
+
+  Eigen::Index rows  = belief.rows();
+  Eigen::Index y_dim = conditional_belief.cols();
+  OpinionBatch result(BatchMatrix(rows, y_dim), BatchVector(rows), BatchMatrix(rows, y_dim));
+  BatchMatrix& b_res = std::get<0>(result);
+  BatchVector& u_res = std::get<1>(result);
+  BatchMatrix& a_res = std::get<2>(result);
+
+  // Independent of the deduced opinion and shared by all rows
+  Eigen::RowVectorXd b_yx_column_min = conditional_belief.colwise().minCoeff();
+
+  detail::parallelFor(static_cast<size_t>(rows), [&](size_t begin, size_t end) {
+    detail::DeductionWorkspace workspace(belief.cols(), y_dim);
+    for (Eigen::Index n = begin; n < static_cast<Eigen::Index>(end); ++n)
+    {
+      detail::deduceRow(belief.row(n),
+                        uncertainty(n),
+                        base_rate.row(n),
+                        conditional_belief,
+                        conditional_uncertainty,
+                        b_yx_column_min,
+                        workspace,
+                        b_res.row(n),
+                        u_res(n),
+                        a_res.row(n));
+    }
+  });
+
+  return result;
+}
+
+void batchBinomialAveragingBeliefFusion(const BatchVectorIn& b1,
+                                        const BatchVectorIn& d1,
+                                        const BatchVectorIn& u1,
+                                        const BatchVectorIn& a1,
+                                        const BatchVectorIn& b2,
+                                        const BatchVectorIn& d2,
+                                        const BatchVectorIn& u2,
+                                        const BatchVectorIn& a2,
+                                        BatchVectorOut b,
+                                        BatchVectorOut d,
+                                        BatchVectorOut u,
+                                        BatchVectorOut a)
+{
+  checkLength(b1.rows(),
+              {d1.rows(), u1.rows(), a1.rows(), b2.rows(), d2.rows(), u2.rows(), a2.rows()});
+  checkLength(b1.rows(), {b.rows(), d.rows(), u.rows(), a.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b1, d1, u1, a1);
+  detail::BinomialArraysIn y             = binomialIn(b2, d2, u2, a2);
+  detail::BinomialArraysOut out          = binomialOut(b, d, u, a);
+
+  detail::parallelFor(static_cast<size_t>(b1.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialAveragingFusion(x, y, out, begin, end);
+  });
+}
+
+void batchBinomialAleatoryCumulativeBeliefFusion(const BatchVectorIn& b1,
+                                                 const BatchVectorIn& d1,
+                                                 const BatchVectorIn& u1,
+                                                 const BatchVectorIn& a1,
+                                                 const BatchVectorIn& b2,
+                                                 const BatchVectorIn& d2,
+                                                 const BatchVectorIn& u2,
+                                                 const BatchVectorIn& a2,
+                                                 BatchVectorOut b,
+                                                 BatchVectorOut d,
+                                                 BatchVectorOut u,
+                                                 BatchVectorOut a)
+{
+  checkLength(b1.rows(),
+              {d1.rows(), u1.rows(), a1.rows(), b2.rows(), d2.rows(), u2.rows(), a2.rows()});
+  checkLength(b1.rows(), {b.rows(), d.rows(), u.rows(), a.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b1, d1, u1, a1);
+  detail::BinomialArraysIn y             = binomialIn(b2, d2, u2, a2);
+  detail::BinomialArraysOut out          = binomialOut(b, d, u, a);
+
+  detail::parallelFor(static_cast<size_t>(b1.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialCumulativeFusion(x, y, out, begin, end);
+  });
+}
+
+void batchBinomialTrustDiscounting(const BatchVectorIn& b_in,
+                                   const BatchVectorIn& d_in,
+                                   const BatchVectorIn& u_in,
+                                   const BatchVectorIn& a_in,
+                                   const BatchVectorIn& discount_probability,
+                                   BatchVectorOut b,
+                                   BatchVectorOut d,
+                                   BatchVectorOut u,
+                                   BatchVectorOut a)
+{
+  checkLength(b_in.rows(), {d_in.rows(), u_in.rows(), a_in.rows(), discount_probability.rows()});
+  checkLength(b_in.rows(), {b.rows(), d.rows(), u.rows(), a.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b_in, d_in, u_in, a_in);
+  detail::ArrayIn p                      = arrayIn(discount_probability);
+  detail::BinomialArraysOut out          = binomialOut(b, d, u, a);
+
+  detail::parallelFor(static_cast<size_t>(b_in.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialTrustDiscounting(x, p, out, begin, end);
+  });
+}
+
+void batchBinomialProjection(const BatchVectorIn& b,
+                             const BatchVectorIn& d,
+                             const BatchVectorIn& u,
+                             const BatchVectorIn& a,
+                             BatchVectorOut projection)
+{
+  checkLength(b.rows(), {d.rows(), u.rows(), a.rows(), projection.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b, d, u, a);
+  detail::ArrayOut out                   = arrayOut(projection);
+
+  detail::parallelFor(static_cast<size_t>(b.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialProjection(x, out, begin, end);
+  });
+}
+
+void batchBinomialVariance(const BatchVectorIn& b,
+                           const BatchVectorIn& d,
+                           const BatchVectorIn& u,
+                           const BatchVectorIn& a,
+                           BatchVectorOut variance)
+{
+  checkLength(b.rows(), {d.rows(), u.rows(), a.rows(), variance.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b, d, u, a);
+  detail::ArrayOut out                   = arrayOut(variance);
+
+  detail::parallelFor(static_cast<size_t>(b.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialVariance(x, out, begin, end);
+  });
+}
+
+void batchBinomialDegreeOfConflict(const BatchVectorIn& b1,
+                                   const BatchVectorIn& d1,
+                                   const BatchVectorIn& u1,
+                                   const BatchVectorIn& a1,
+                                   const BatchVectorIn& b2,
+                                   const BatchVectorIn& d2,
+                                   const BatchVectorIn& u2,
+                                   const BatchVectorIn& a2,
+                                   BatchVectorOut conflict)
+{
+  checkLength(b1.rows(),
+              {d1.rows(), u1.rows(), a1.rows(), b2.rows(), d2.rows(), u2.rows(), a2.rows()});
+  checkLength(b1.rows(), {conflict.rows()});
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  detail::BinomialArraysIn x             = binomialIn(b1, d1, u1, a1);
+  detail::BinomialArraysIn y             = binomialIn(b2, d2, u2, a2);
+  detail::ArrayOut out                   = arrayOut(conflict);
+
+  detail::parallelFor(static_cast<size_t>(b1.rows()), [&](size_t begin, size_t end) {
+    kernels.binomialDegreeOfConflict(x, y, out, begin, end);
+  });
+}
+
+} // namespace subj
@@ -0,0 +1,124 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_BINOMIAL_KERNELS_H_INCLUDED
+#define SUBJ_BINOMIAL_KERNELS_H_INCLUDED
+
+#include <cmath>
+
+namespace subj {
+namespace detail {
+
+// Plain (belief, disbelief, uncertainty, base rate) values of a binomial opinion, used by the
+// closed-form element-wise kernels below.
+struct BinomialValues
+{
+  double b;
+  double d;
+  double u;
+  double a;
+};
+
+inline double binomialProjection(const BinomialValues& x)
+{
+  return x.b + x.a * x.u;
+}
+
+// Same as MultinomialOpinion::varianceMat() with a prior weight of 2.
+inline double binomialVariance(const BinomialValues& x)
+{
+  double p = binomialProjection(x);
+  return (p * (1.0 - p) * x.u) / (2.0 * x.u);
+}
+
+inline double binomialDegreeOfConflict(const BinomialValues& x, const BinomialValues& y)
+{
+  return std::abs(binomialProjection(x) - binomialProjection(y)) * (1.0 - x.u) * (1.0 - y.u);
+}
+
+inline BinomialValues binomialTrustDiscounting(const BinomialValues& x, double discount_probability)
+{
+  return {discount_probability * x.b,
+          discount_probability * x.d,
+          1.0 - discount_probability * (x.b + x.d),
+          x.a};
+}
+
+// Base rate of the two-opinion fusion, shared by averaging and cumulative fusion.
+inline double binomialFusedBaseRate(const BinomialValues& x, const BinomialValues& y)
+{
+  double norm = x.u + y.u - 2.0 * x.u * y.u;
+  if (norm == 0.0)
+  {
+    return (x.a + y.a) / 2.0;
+  }
+  return (x.a * y.u + y.a * x.u - (x.a + y.a) * x.u * y.u) / norm;
+}
+
+inline BinomialValues binomialAveragingFusion(const BinomialValues& x, const BinomialValues& y)
+{
+  double norm = x.u + y.u;
+  if (norm == 0.0)
+  {
+    return {(x.b + y.b) / 2.0, (x.d + y.d) / 2.0, 0.0, (x.a + y.a) / 2.0};
+  }
+  return {(x.b * y.u + y.b * x.u) / norm,
+          (x.d * y.u + y.d * x.u) / norm,
+          2.0 * x.u * y.u / norm,
+          binomialFusedBaseRate(x, y)};
+}
+
+inline BinomialValues binomialCumulativeFusion(const BinomialValues& x, const BinomialValues& y)
+{
+  if (x.u == 1.0 && y.u == 1.0)
+  {
+    return x;
+  }
+  double norm = x.u + y.u - x.u * y.u;
+  if (norm == 0.0)
+  {
+    return {(x.b + y.b) / 2.0, (x.d + y.d) / 2.0, 0.0, (x.a + y.a) / 2.0};
+  }
+  return {(x.b * y.u + y.b * x.u) / norm,
+          (x.d * y.u + y.d * x.u) / norm,
+          x.u * y.u / norm,
+          binomialFusedBaseRate(x, y)};
+}
+
+} // namespace detail
+} // namespace subj
+
+#endif /* SUBJ_BINOMIAL_KERNELS_H_INCLUDED */
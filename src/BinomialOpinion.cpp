@@ -36,6 +36,10 @@
 
 #include <subj/BinomialOpinion.h>
 
+#ifndef SUBJ_INLINE_ACCESSORS
+#include <subj/BinomialOpinion.inl>
+#endif
+
 #include <stdexcept>
 
 namespace subj {
@@ -51,8 +55,7 @@ BinomialOpinion::BinomialOpinion(double belief,
                                  double base_rate)
   : MultinomialOpinion(2)
 {
-  m_belief    = Vector(2);
-  m_base_rate = Vector(2);
+  m_belief = Vector(2);
 
   updateBelief(belief);
   updateDisbelief(disbelief);
@@ -70,30 +73,6 @@ bool BinomialOpinion::update(double belief, double disbelief, double uncertainty
   return (b || d || u || a);
 }
 
-bool BinomialOpinion::updateBelief(double belief)
-{
-  MultinomialOpinion::m_belief(0) = belief;
-
-  return true;
-}
-
-bool BinomialOpinion::b(double belief)
-{
-  return updateBelief(belief);
-}
-
-bool BinomialOpinion::updateDisbelief(double disbelief)
-{
-  MultinomialOpinion::m_belief(1) = disbelief;
-
-  return true;
-}
-
-bool BinomialOpinion::d(double disbelief)
-{
-  return updateDisbelief(disbelief);
-}
-
 bool BinomialOpinion::updateBaseRate(double base_rate)
 {
   Vector br_vec(2);
@@ -108,56 +87,6 @@ bool BinomialOpinion::a(double base_rate)
   return updateBaseRate(base_rate);
 }
 
-double BinomialOpinion::belief() const
-{
-  return MultinomialOpinion::beliefMat()(0);
-}
-
-double BinomialOpinion::b() const
-{
-  return belief();
-}
-
-double BinomialOpinion::disbelief() const
-{
-  return MultinomialOpinion::beliefMat()(1);
-}
-
-double BinomialOpinion::d() const
-{
-  return disbelief();
-}
-
-double BinomialOpinion::baseRate() const
-{
-  return MultinomialOpinion::baseRateMat()(0);
-}
-
-double BinomialOpinion::a() const
-{
-  return baseRate();
-}
-
-double BinomialOpinion::projection() const
-{
-  return MultinomialOpinion::projectionMat()(0);
-}
-
-double BinomialOpinion::p() const
-{
-  return projection();
-}
-
-double BinomialOpinion::variance() const
-{
-  return MultinomialOpinion::varianceMat()(0);
-}
-
-double BinomialOpinion::var() const
-{
-  return variance();
-}
-
 std::ostream& operator<<(std::ostream& os, const BinomialOpinion& opinion)
 {
   os << "(b=" << opinion.belief() << ", d=" << opinion.disbelief()
@@ -0,0 +1,474 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/CompactOpinions.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+using Code       = QuantizedOpinions::Code;
+using CodeMatrix = QuantizedOpinions::CodeMatrix;
+// Column-major, such that the operations on all rows of a block vectorize over the opinions
+using Values = Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic>;
+
+// Values encoded per block, such that the double precision temporaries stay in cache.
+const Eigen::Index BLOCK_VALUES = 8192;
+
+Eigen::Index blockRows(const Eigen::Index& dim)
+{
+  return std::max<Eigen::Index>(1, BLOCK_VALUES / (dim + 1));
+}
+
+// Encodes rows of non-negative values as codes summing exactly to SCALE, giving the same codes as
+// rounding down and handing the units left to the largest remainders. All rows are scaled to SCALE
+// and rounded to nearest at once, which leaves most rows with the right sum. The few units missing
+// or in surplus are settled per row at the values rounded down or up the most.
+class Encoder
+{
+public:
+  // Encodes the rows of values into codes, overwriting the values.
+  void operator()(Values& values, Eigen::Ref<CodeMatrix> codes)
+  {
+    const double scale = QuantizedOpinions::SCALE;
+
+    values = values.cwiseMax(0.0);
+    m_sum  = values.rowwise().sum();
+    if (!values.allFinite() || !(m_sum > 0.0).all())
+    {
+      throw std::invalid_argument("Opinions must be finite and sum to a positive value!");
+    }
+
+    // Truncation rounds as the shifted values are not negative, the values keep the errors
+    values.colwise() *= scale / m_sum;
+    codes = (values + 0.5).cast<Code>().matrix();
+    values -= codes.cast<double>().array();
+    m_sum = scale - codes.cast<double>().array().rowwise().sum();
+
+    for (Eigen::Index r = 0; r < values.rows(); ++r)
+    {
+      if (m_sum(r) != 0.0)
+      {
+        settle(values.row(r), codes.row(r), static_cast<Eigen::Index>(m_sum(r)));
+      }
+    }
+  }
+
+private:
+  // Surplus or missing units settled by repeated scans, larger counts are settled by selection.
+  static const Eigen::Index SCAN_UNITS = 8;
+
+  template <typename Error, typename Codes>
+  void settle(Error error, Codes codes, Eigen::Index units)
+  {
+    const double sign = units > 0 ? 1.0 : -1.0;
+    const Code step   = units > 0 ? Code(1) : Code(-1);
+    units             = std::min(std::abs(units), error.size());
+
+    if (units <= SCAN_UNITS)
+    {
+      for (Eigen::Index i = 0; i < units; ++i)
+      {
+        Eigen::Index c;
+        (sign * error).maxCoeff(&c);
+        error(c) = -sign;
+        codes(c) += step;
+      }
+      return;
+    }
+
+    m_order.resize(static_cast<size_t>(error.size()));
+    for (Eigen::Index c = 0; c < error.size(); ++c)
+    {
+      m_order[c] = c;
+    }
+    std::nth_element(m_order.begin(),
+                     m_order.begin() + (units - 1),
+                     m_order.end(),
+                     [&error, &sign](const Eigen::Index& i, const Eigen::Index& j) {
+                       return sign * error(i) > sign * error(j) ||
+                              (error(i) == error(j) && i < j);
+                     });
+    for (Eigen::Index i = 0; i < units; ++i)
+    {
+      codes(m_order[i]) += step;
+    }
+  }
+
+private:
+  Eigen::ArrayXd m_sum;
+  std::vector<Eigen::Index> m_order;
+};
+
+template <typename Belief, typename Uncertainty, typename BaseRate>
+void encode(const Eigen::MatrixBase<Belief>& belief,
+            const Eigen::MatrixBase<Uncertainty>& uncertainty,
+            const Eigen::MatrixBase<BaseRate>& base_rate,
+            CodeMatrix& mass_codes,
+            CodeMatrix& base_rate_codes)
+{
+  const Eigen::Index count = belief.rows();
+  const Eigen::Index dim   = belief.cols();
+
+  if (uncertainty.size() != count || base_rate.rows() != count || base_rate.cols() != dim)
+  {
+    throw std::invalid_argument("Belief, uncertainty and base rate must describe the same opinions!");
+  }
+
+  mass_codes.resize(count, dim + 1);
+  base_rate_codes.resize(count, dim);
+
+  Encoder encoder;
+  Values mass;
+  Values rate;
+  const Eigen::Index block = blockRows(dim);
+  for (Eigen::Index begin = 0; begin < count; begin += block)
+  {
+    Eigen::Index rows = std::min(block, count - begin);
+
+    mass.resize(rows, dim + 1);
+    mass.leftCols(dim) = belief.middleRows(begin, rows).template cast<double>().array();
+    mass.col(dim)      = uncertainty.segment(begin, rows).template cast<double>().array();
+    encoder(mass, mass_codes.middleRows(begin, rows));
+
+    rate = base_rate.middleRows(begin, rows).template cast<double>().array();
+    encoder(rate, base_rate_codes.middleRows(begin, rows));
+  }
+}
+
+Eigen::Index commonDimension(const std::vector<MultinomialOpinion>& opinions)
+{
+  Eigen::Index dim = opinions.empty() ? 0 : opinions[0].dim();
+  for (const MultinomialOpinion& o : opinions)
+  {
+    if (o.dim() != dim)
+    {
+      throw std::invalid_argument("All opinions must have the same dimensions!");
+    }
+  }
+  return dim;
+}
+
+} // namespace
+
+template <typename Scalar>
+OpinionColumns<Scalar>::OpinionColumns(const size_t& count, const Eigen::Index& dimensions)
+  : m_belief(Matrix::Zero(count, dimensions))
+  , m_uncertainty(Vector::Ones(count))
+  , m_base_rate(Matrix::Constant(count, dimensions, Scalar(1) / Scalar(dimensions)))
+{
+}
+
+template <typename Scalar>
+OpinionColumns<Scalar>::OpinionColumns(const std::vector<MultinomialOpinion>& opinions)
+  : OpinionColumns(0, commonDimension(opinions))
+{
+  m_belief.resize(opinions.size(), dim());
+  m_uncertainty.resize(opinions.size());
+  m_base_rate.resize(opinions.size(), dim());
+
+  for (size_t i = 0; i < opinions.size(); ++i)
+  {
+    set(i, opinions[i]);
+  }
+}
+
+template <typename Scalar>
+OpinionColumns<Scalar>::OpinionColumns(const Eigen::Ref<const BatchMatrix>& belief,
+                                       const Eigen::Ref<const BatchVector>& uncertainty,
+                                       const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  if (uncertainty.size() != belief.rows() || base_rate.rows() != belief.rows() ||
+      base_rate.cols() != belief.cols())
+  {
+    throw std::invalid_argument("Belief, uncertainty and base rate must describe the same opinions!");
+  }
+
+  m_belief      = belief.cast<Scalar>();
+  m_uncertainty = uncertainty.cast<Scalar>();
+  m_base_rate   = base_rate.cast<Scalar>();
+}
+
+template <typename Scalar>
+void OpinionColumns<Scalar>::set(const size_t& index, const MultinomialOpinion& opinion)
+{
+  if (index >= count())
+  {
+    throw std::out_of_range("Opinion index out of range!");
+  }
+  if (opinion.dim() != dim())
+  {
+    throw std::invalid_argument("All opinions must have the same dimensions!");
+  }
+
+  Eigen::Index row    = static_cast<Eigen::Index>(index);
+  m_belief.row(row)    = opinion.beliefMat().transpose().cast<Scalar>();
+  m_uncertainty(row)   = static_cast<Scalar>(opinion.uncertainty());
+  m_base_rate.row(row) = opinion.baseRateMat().transpose().cast<Scalar>();
+}
+
+template <typename Scalar>
+MultinomialOpinion OpinionColumns<Scalar>::opinion(const size_t& index) const
+{
+  if (index >= count())
+  {
+    throw std::out_of_range("Opinion index out of range!");
+  }
+
+  Eigen::Index row = static_cast<Eigen::Index>(index);
+  return MultinomialOpinion(m_belief.row(row).transpose().template cast<double>(),
+                            static_cast<double>(m_uncertainty(row)),
+                            m_base_rate.row(row).transpose().template cast<double>());
+}
+
+template <typename Scalar>
+std::vector<MultinomialOpinion> OpinionColumns<Scalar>::opinions() const
+{
+  std::vector<MultinomialOpinion> opinions;
+  opinions.reserve(count());
+  for (size_t i = 0; i < count(); ++i)
+  {
+    opinions.push_back(opinion(i));
+  }
+  return opinions;
+}
+
+template <typename Scalar>
+OpinionBatch OpinionColumns<Scalar>::batch() const
+{
+  return OpinionBatch(m_belief.template cast<double>(),
+                      m_uncertainty.template cast<double>(),
+                      m_base_rate.template cast<double>());
+}
+
+template <typename Scalar>
+const typename OpinionColumns<Scalar>::Matrix& OpinionColumns<Scalar>::belief() const
+{
+  return m_belief;
+}
+
+template <typename Scalar>
+const typename OpinionColumns<Scalar>::Vector& OpinionColumns<Scalar>::uncertainty() const
+{
+  return m_uncertainty;
+}
+
+template <typename Scalar>
+const typename OpinionColumns<Scalar>::Matrix& OpinionColumns<Scalar>::baseRate() const
+{
+  return m_base_rate;
+}
+
+template <typename Scalar>
+size_t OpinionColumns<Scalar>::count() const
+{
+  return static_cast<size_t>(m_uncertainty.size());
+}
+
+template <typename Scalar>
+Eigen::Index OpinionColumns<Scalar>::dim() const
+{
+  return m_belief.cols();
+}
+
+template <typename Scalar>
+size_t OpinionColumns<Scalar>::bytes() const
+{
+  return static_cast<size_t>(m_belief.size() + m_uncertainty.size() + m_base_rate.size()) *
+         sizeof(Scalar);
+}
+
+template class OpinionColumns<float>;
+template class OpinionColumns<double>;
+
+const QuantizedOpinions::Code QuantizedOpinions::SCALE;
+
+QuantizedOpinions::QuantizedOpinions()
+  : m_mass(0, 1)
+  , m_base_rate(0, 0)
+{
+}
+
+QuantizedOpinions::QuantizedOpinions(const std::vector<MultinomialOpinion>& opinions)
+{
+  const Eigen::Index count = static_cast<Eigen::Index>(opinions.size());
+  const Eigen::Index dim   = commonDimension(opinions);
+
+  m_mass.resize(count, dim + 1);
+  m_base_rate.resize(count, dim);
+
+  Encoder encoder;
+  Values mass;
+  Values rate;
+  const Eigen::Index block = blockRows(dim);
+  for (Eigen::Index begin = 0; begin < count; begin += block)
+  {
+    Eigen::Index rows = std::min(block, count - begin);
+
+    mass.resize(rows, dim + 1);
+    rate.resize(rows, dim);
+    for (Eigen::Index r = 0; r < rows; ++r)
+    {
+      const MultinomialOpinion& o = opinions[static_cast<size_t>(begin + r)];
+      mass.row(r).head(dim)       = o.beliefMat().transpose().array();
+      mass(r, dim)                = o.uncertainty();
+      rate.row(r)                 = o.baseRateMat().transpose().array();
+    }
+    encoder(mass, m_mass.middleRows(begin, rows));
+    encoder(rate, m_base_rate.middleRows(begin, rows));
+  }
+}
+
+QuantizedOpinions::QuantizedOpinions(const Eigen::Ref<const BatchMatrix>& belief,
+                                     const Eigen::Ref<const BatchVector>& uncertainty,
+                                     const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  encode(belief, uncertainty, base_rate, m_mass, m_base_rate);
+}
+
+template <typename Scalar>
+QuantizedOpinions::QuantizedOpinions(const OpinionColumns<Scalar>& columns)
+{
+  encode(columns.belief(), columns.uncertainty(), columns.baseRate(), m_mass, m_base_rate);
+}
+
+template QuantizedOpinions::QuantizedOpinions(const OpinionColumns<float>&);
+template QuantizedOpinions::QuantizedOpinions(const OpinionColumns<double>&);
+
+QuantizedOpinions::QuantizedOpinions(const CodeMatrix& mass, const CodeMatrix& base_rate)
+  : m_mass(mass)
+  , m_base_rate(base_rate)
+{
+  if (m_mass.cols() != m_base_rate.cols() + 1 || m_mass.rows() != m_base_rate.rows())
+  {
+    throw std::invalid_argument("Mass and base rate codes must describe the same opinions!");
+  }
+  if ((m_mass.cast<uint64_t>().rowwise().sum().array() != SCALE).any() ||
+      (m_base_rate.cast<uint64_t>().rowwise().sum().array() != SCALE).any())
+  {
+    throw std::invalid_argument("Every row of codes must sum to SCALE!");
+  }
+}
+
+MultinomialOpinion QuantizedOpinions::opinion(const size_t& index) const
+{
+  if (index >= count())
+  {
+    throw std::out_of_range("Opinion index out of range!");
+  }
+
+  const double scale = SCALE;
+  Eigen::Index row   = static_cast<Eigen::Index>(index);
+  return MultinomialOpinion(m_mass.row(row).head(dim()).transpose().cast<double>() / scale,
+                            m_mass(row, dim()) / scale,
+                            m_base_rate.row(row).transpose().cast<double>() / scale);
+}
+
+std::vector<MultinomialOpinion> QuantizedOpinions::opinions() const
+{
+  const double scale = SCALE;
+
+  std::vector<MultinomialOpinion> opinions;
+  opinions.reserve(count());
+  for (Eigen::Index row = 0; row < m_mass.rows(); ++row)
+  {
+    if (row > 0 && m_base_rate.row(row) == m_base_rate.row(row - 1))
+    {
+      opinions.emplace_back(m_mass.row(row).head(dim()).transpose().cast<double>() / scale,
+                            m_mass(row, dim()) / scale,
+                            opinions.back().baseRateHandle());
+    }
+    else
+    {
+      opinions.push_back(opinion(static_cast<size_t>(row)));
+    }
+  }
+  return opinions;
+}
+
+OpinionBatch QuantizedOpinions::batch() const
+{
+  const double scale = SCALE;
+  return OpinionBatch(m_mass.leftCols(dim()).cast<double>() / scale,
+                      m_mass.col(dim()).cast<double>() / scale,
+                      m_base_rate.cast<double>() / scale);
+}
+
+template <typename Scalar>
+OpinionColumns<Scalar> QuantizedOpinions::columns() const
+{
+  const Scalar scale = SCALE;
+
+  OpinionColumns<Scalar> columns;
+  columns.m_belief      = m_mass.leftCols(dim()).cast<Scalar>() / scale;
+  columns.m_uncertainty = m_mass.col(dim()).cast<Scalar>() / scale;
+  columns.m_base_rate   = m_base_rate.cast<Scalar>() / scale;
+  return columns;
+}
+
+template OpinionColumns<float> QuantizedOpinions::columns() const;
+template OpinionColumns<double> QuantizedOpinions::columns() const;
+
+const QuantizedOpinions::CodeMatrix& QuantizedOpinions::mass() const
+{
+  return m_mass;
+}
+
+const QuantizedOpinions::CodeMatrix& QuantizedOpinions::baseRate() const
+{
+  return m_base_rate;
+}
+
+size_t QuantizedOpinions::count() const
+{
+  return static_cast<size_t>(m_mass.rows());
+}
+
+Eigen::Index QuantizedOpinions::dim() const
+{
+  return m_base_rate.cols();
+}
+
+size_t QuantizedOpinions::bytes() const
+{
+  return static_cast<size_t>(m_mass.size() + m_base_rate.size()) * sizeof(Code);
+}
+
+} // namespace subj
@@ -0,0 +1,146 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/DecayingOpinion.h>
+
+#include <subj/Operators.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace subj {
+
+MultinomialOpinion evidenceDecay(const MultinomialOpinion& opinion, const double& factor)
+{
+  if (factor < 0.0 || factor > 1.0)
+  {
+    throw std::invalid_argument("The decay factor has to be in [0, 1]");
+  }
+
+  MultinomialOpinion decayed = opinion;
+  if (factor == 1.0)
+  {
+    return decayed;
+  }
+
+  double uncertainty = opinion.uncertainty();
+  double denominator = uncertainty + factor * (1.0 - uncertainty);
+  if (denominator <= 0.0)
+  {
+    // All evidence of a dogmatic opinion is gone
+    decayed.updateBelief(MultinomialOpinion::Vector::Zero(opinion.dim()));
+    decayed.updateUncertainty(1.0);
+    return decayed;
+  }
+  decayed.updateBelief(opinion.beliefMat() * (factor / denominator));
+  decayed.updateUncertainty(uncertainty / denominator);
+  return decayed;
+}
+
+DecayingOpinion::DecayingOpinion(const MultinomialOpinion& opinion,
+                                 const double& timestamp,
+                                 const double& half_life)
+  : m_opinion(opinion)
+  , m_timestamp(timestamp)
+  , m_half_life(half_life)
+{
+  if (!(half_life > 0.0))
+  {
+    throw std::invalid_argument("The half-life has to be positive");
+  }
+  m_decay_rate = std::log(2.0) / half_life;
+}
+
+MultinomialOpinion DecayingOpinion::opinion(const double& time) const
+{
+  return evidenceDecay(m_opinion, decayFactor(time - m_timestamp));
+}
+
+MultinomialOpinion DecayingOpinion::at(const double& time) const
+{
+  return opinion(time);
+}
+
+void DecayingOpinion::fuseIn(const MultinomialOpinion& opinion, const double& time)
+{
+  if (time >= m_timestamp)
+  {
+    m_opinion   = cbf(evidenceDecay(m_opinion, decayFactor(time - m_timestamp)), opinion);
+    m_timestamp = time;
+  }
+  else
+  {
+    m_opinion = cbf(m_opinion, evidenceDecay(opinion, decayFactor(m_timestamp - time)));
+  }
+}
+
+void DecayingOpinion::update(const MultinomialOpinion& opinion, const double& time)
+{
+  m_opinion   = opinion;
+  m_timestamp = time;
+}
+
+const MultinomialOpinion& DecayingOpinion::storedOpinion() const
+{
+  return m_opinion;
+}
+
+double DecayingOpinion::timestamp() const
+{
+  return m_timestamp;
+}
+
+double DecayingOpinion::halfLife() const
+{
+  return m_half_life;
+}
+
+double DecayingOpinion::decayFactor(const double& elapsed) const
+{
+  if (elapsed <= 0.0)
+  {
+    return 1.0;
+  }
+  return std::exp(-m_decay_rate * elapsed);
+}
+
+Eigen::Index DecayingOpinion::dim() const
+{
+  return m_opinion.dim();
+}
+
+} // namespace subj
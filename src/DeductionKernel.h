@@ -0,0 +1,118 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_DEDUCTION_KERNEL_H_INCLUDED
+#define SUBJ_DEDUCTION_KERNEL_H_INCLUDED
+
+#include <subj/Batch.h>
+
+#include <Eigen/Dense>
+
+namespace subj {
+namespace detail {
+
+// Conditional opinions of a deduction as X x Y beliefs and X uncertainties, together with the
+// column minima of the beliefs, which only depend on the conditionals and can be reused for every
+// deduced opinion.
+struct DeductionState
+{
+  BatchMatrix belief;
+  BatchVector uncertainty;
+  Eigen::RowVectorXd belief_column_min;
+
+  DeductionState() = default;
+  DeductionState(const Eigen::Ref<const BatchMatrix>& conditional_belief,
+                 const Eigen::Ref<const BatchVector>& conditional_uncertainty)
+    : belief(conditional_belief)
+    , uncertainty(conditional_uncertainty)
+    , belief_column_min(conditional_belief.colwise().minCoeff())
+  {
+  }
+};
+
+// Temporaries of deduceRow(), allocated once per thread.
+struct DeductionWorkspace
+{
+  Eigen::RowVectorXd p_yxhat;
+  Eigen::RowVectorXd p_yx;
+  Eigen::RowVectorXd p_x;
+
+  DeductionWorkspace(Eigen::Index x_dim, Eigen::Index y_dim)
+    : p_yxhat(y_dim)
+    , p_yx(y_dim)
+    , p_x(x_dim)
+  {
+  }
+};
+
+// Same as deduction() for the opinion (belief, uncertainty, base_rate) through the conditionals of
+// the state, writing the deduced opinion into the outputs.
+template <typename BeliefIn, typename BaseRateIn, typename BeliefOut, typename BaseRateOut>
+inline void deduceRow(const BeliefIn& belief,
+                      double uncertainty,
+                      const BaseRateIn& base_rate,
+                      const Eigen::Ref<const BatchMatrix>& conditional_belief,
+                      const Eigen::Ref<const BatchVector>& conditional_uncertainty,
+                      const Eigen::Ref<const Eigen::RowVectorXd>& belief_column_min,
+                      DeductionWorkspace& workspace,
+                      BeliefOut&& belief_out,
+                      double& uncertainty_out,
+                      BaseRateOut&& base_rate_out)
+{
+  // MBR
+  double a_u = base_rate.dot(conditional_uncertainty.transpose());
+  base_rate_out = (base_rate * conditional_belief) / (1.0 - a_u);
+
+  // Sub-Simplex Apex Uncertainty
+  workspace.p_yxhat = base_rate * conditional_belief + a_u * base_rate_out;
+  double u_yxhat =
+    ((workspace.p_yxhat - belief_column_min).array() / base_rate_out.array()).minCoeff();
+
+  double u_yx = uncertainty * u_yxhat + belief.dot(conditional_uncertainty.transpose());
+
+  workspace.p_x  = belief + base_rate * uncertainty;
+  workspace.p_yx = workspace.p_x * conditional_belief +
+                   workspace.p_x.dot(conditional_uncertainty.transpose()) * base_rate_out;
+
+  belief_out      = workspace.p_yx - base_rate_out * u_yx;
+  uncertainty_out = u_yx;
+}
+
+} // namespace detail
+} // namespace subj
+
+#endif /* SUBJ_DEDUCTION_KERNEL_H_INCLUDED */
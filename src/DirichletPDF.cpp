@@ -36,9 +36,13 @@
 
 #include <subj/DirichletPDF.h>
 
+#include "NumericKernels.h"
+#include "Parallel.h"
+
 #include <Eigen/Dense>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
 namespace subj {
@@ -56,7 +60,7 @@ void DirichletPDF::updateEvidence(const std::vector<double>& evidence)
     evidence.data(), (Eigen::Index)evidence.size()));
 }
 
-void DirichletPDF::updateEvidence(const Eigen::Matrix<double, Eigen::Dynamic, 1>& evidence)
+void DirichletPDF::updateEvidence(const Eigen::Ref<const Eigen::VectorXd>& evidence)
 {
   // TODO Check dimensions
   m_evidence = evidence;
@@ -73,7 +77,7 @@ void DirichletPDF::updateBaseRate(const std::vector<double>& base_rate)
     base_rate.data(), (Eigen::Index)base_rate.size()));
 }
 
-void DirichletPDF::updateBaseRate(const Eigen::Matrix<double, Eigen::Dynamic, 1>& base_rate)
+void DirichletPDF::updateBaseRate(const Eigen::Ref<const Eigen::VectorXd>& base_rate)
 {
   // TODO Check dimensions
   m_base_rate = base_rate;
@@ -84,7 +88,7 @@ std::vector<double> DirichletPDF::evidence() const
   return std::vector<double>(m_evidence.data(), m_evidence.data() + m_evidence.size());
 }
 
-Eigen::VectorXd DirichletPDF::evidenceMat() const
+const Eigen::VectorXd& DirichletPDF::evidenceMat() const
 {
   return m_evidence;
 }
@@ -94,7 +98,7 @@ std::vector<double> DirichletPDF::baseRate() const
   return std::vector<double>(m_base_rate.data(), m_base_rate.data() + m_base_rate.size());
 }
 
-Eigen::VectorXd DirichletPDF::baseRateMat() const
+const Eigen::VectorXd& DirichletPDF::baseRateMat() const
 {
   return m_base_rate;
 }
@@ -121,11 +125,10 @@ double DirichletPDF::density(const std::vector<double>& x) const
     Eigen::Map<const Eigen::VectorXd, Eigen::Unaligned>(x.data(), (Eigen::Index)x.size()));
 }
 
-double DirichletPDF::density(const Eigen::Matrix<double, Eigen::Dynamic, 1>& x) const
+double DirichletPDF::density(const Eigen::Ref<const Eigen::VectorXd>& x) const
 {
   // TODO check size?
-  Eigen::Matrix<double, Eigen::Dynamic, 1> alpha = Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(
-    strength().data(), (Eigen::Index)strength().size());
+  Eigen::VectorXd alpha = strengthMat();
 
   double gamma_prod = 1.0;
   for (int i = 0; i < x.rows(); ++i)
@@ -144,6 +147,42 @@ double DirichletPDF::density(const Eigen::Matrix<double, Eigen::Dynamic, 1>& x)
          pow_prod; // TODO handle loss of precision
 }
 
+double DirichletPDF::logDensity(const Eigen::Ref<const Eigen::VectorXd>& x) const
+{
+  BatchMatrix point = x.transpose();
+  return logDensities(point)(0);
+}
+
+BatchVector DirichletPDF::logDensities(const Eigen::Ref<const BatchMatrix>& x) const
+{
+  if (x.cols() != m_evidence.rows())
+  {
+    throw std::invalid_argument("Points must have the dimension of the dirichlet pdf!");
+  }
+
+  Eigen::VectorXd alpha           = strengthMat();
+  Eigen::VectorXd alpha_minus_one = alpha.array() - 1.0;
+  double log_normalization        = std::lgamma(alpha.sum());
+  for (Eigen::Index i = 0; i < alpha.rows(); ++i)
+  {
+    log_normalization -= std::lgamma(alpha(i));
+  }
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  BatchVector log_density(x.rows());
+  detail::parallelFor(static_cast<size_t>(x.rows()), [&](size_t begin, size_t end) {
+    kernels.dirichletLogDensity(x.data(),
+                                x.outerStride(),
+                                x.cols(),
+                                alpha_minus_one.data(),
+                                log_normalization,
+                                log_density.data(),
+                                begin,
+                                end);
+  });
+  return log_density;
+}
+
 std::ostream& operator<<(std::ostream& os, const DirichletPDF& pdf)
 {
   os << "Dir^e(p, r=(" << pdf.m_evidence(0);
@@ -0,0 +1,142 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/Dispatch.h>
+
+#include "NumericKernels.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+namespace subj {
+
+namespace {
+
+IsaLevel detectIsaLevel()
+{
+#ifdef SUBJ_X86_KERNELS
+  __builtin_cpu_init();
+  bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  if (avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+      __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl"))
+  {
+    return IsaLevel::AVX512;
+  }
+  if (avx2)
+  {
+    return IsaLevel::AVX2;
+  }
+#endif
+  return IsaLevel::BASELINE;
+}
+
+IsaLevel initialIsaLevel()
+{
+  const char* name = std::getenv("SUBJ_ISA");
+  if (name != nullptr)
+  {
+    for (IsaLevel level : {IsaLevel::BASELINE, IsaLevel::AVX2, IsaLevel::AVX512})
+    {
+      if (std::strcmp(name, isaName(level)) == 0 && isaSupported(level))
+      {
+        return level;
+      }
+    }
+  }
+  return supportedIsaLevel();
+}
+
+std::atomic<IsaLevel>& currentIsaLevel()
+{
+  static std::atomic<IsaLevel> level(initialIsaLevel());
+  return level;
+}
+
+} // namespace
+
+IsaLevel supportedIsaLevel()
+{
+  static const IsaLevel level = detectIsaLevel();
+  return level;
+}
+
+bool isaSupported(IsaLevel level)
+{
+  return static_cast<int>(level) <= static_cast<int>(supportedIsaLevel());
+}
+
+IsaLevel isaLevel()
+{
+  return currentIsaLevel().load(std::memory_order_relaxed);
+}
+
+void setIsaLevel(IsaLevel level)
+{
+  if (!isaSupported(level))
+  {
+    throw std::invalid_argument(std::string("Instruction set level ") + isaName(level) +
+                                " is not supported by this CPU!");
+  }
+  currentIsaLevel().store(level, std::memory_order_relaxed);
+}
+
+const char* isaName(IsaLevel level)
+{
+  switch (level)
+  {
+    case IsaLevel::AVX2:
+      return "avx2";
+    case IsaLevel::AVX512:
+      return "avx512";
+    default:
+      return "baseline";
+  }
+}
+
+namespace detail {
+
+const NumericKernels& numericKernels()
+{
+  return numericKernels(isaLevel());
+}
+
+} // namespace detail
+
+} // namespace subj
@@ -0,0 +1,538 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/EvidenceIngestion.h>
+
+#include "Parallel.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace subj {
+
+namespace {
+
+// Open addressing hash index of the entity ids, storing the ids in one contiguous arena. Rows are
+// assigned in order of insertion.
+class KeyIndex
+{
+public:
+  KeyIndex()
+    : m_slots(1024, Slot{0, EMPTY, 0})
+    , m_offsets(1, 0)
+  {
+  }
+
+  // Returns the row of the given key and whether it was inserted.
+  std::pair<size_t, bool> insert(const char* key, size_t length)
+  {
+    uint64_t hash = hashKey(key, length);
+    size_t mask   = m_slots.size() - 1;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+      Slot& slot = m_slots[i];
+      if (slot.row == EMPTY)
+      {
+        slot.hash   = hash;
+        slot.row    = static_cast<uint32_t>(size());
+        slot.length = static_cast<uint32_t>(length);
+        m_arena.insert(m_arena.end(), key, key + length);
+        m_offsets.push_back(m_arena.size());
+        if (size() * 2 > m_slots.size())
+        {
+          grow();
+        }
+        return std::make_pair(size() - 1, true);
+      }
+      if (slot.hash == hash && slot.length == length &&
+          std::memcmp(keyData(slot.row), key, length) == 0)
+      {
+        return std::make_pair(static_cast<size_t>(slot.row), false);
+      }
+    }
+  }
+
+  size_t size() const { return m_offsets.size() - 1; }
+
+  const char* keyData(size_t row) const { return m_arena.data() + m_offsets[row]; }
+
+  size_t keyLength(size_t row) const { return m_offsets[row + 1] - m_offsets[row]; }
+
+private:
+  static const uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+
+  struct Slot
+  {
+    uint64_t hash;
+    uint32_t row;
+    uint32_t length;
+  };
+
+  static uint64_t hashKey(const char* key, size_t length)
+  {
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ length;
+    uint64_t word;
+    for (; length >= 8; key += 8, length -= 8)
+    {
+      std::memcpy(&word, key, 8);
+      hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+      hash ^= hash >> 32;
+    }
+    word = 0;
+    std::memcpy(&word, key, length);
+    hash ^= word;
+    hash = (hash ^ (hash >> 33)) * 0xFF51AFD7ED558CCDull;
+    hash = (hash ^ (hash >> 33)) * 0xC4CEB9FE1A85EC53ull;
+    return hash ^ (hash >> 33);
+  }
+
+  void grow()
+  {
+    std::vector<Slot> slots(m_slots.size() * 2, Slot{0, EMPTY, 0});
+    size_t mask = slots.size() - 1;
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.row != EMPTY)
+      {
+        size_t i = slot.hash & mask;
+        while (slots[i].row != EMPTY)
+        {
+          i = (i + 1) & mask;
+        }
+        slots[i] = slot;
+      }
+    }
+    m_slots.swap(slots);
+  }
+
+  std::vector<Slot> m_slots;
+  std::vector<char> m_arena;
+  std::vector<size_t> m_offsets;
+};
+
+const uint32_t KeyIndex::EMPTY;
+
+// Evidence of one chunk of the input. Each row holds the evidence of all categories followed by the
+// timestamp, so that an update touches a single row.
+struct PartialEvidence
+{
+  KeyIndex index;
+  std::vector<double> rows;
+};
+
+const double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+void trim(const char*& begin, const char*& end)
+{
+  while (begin < end && isBlank(*begin))
+  {
+    ++begin;
+  }
+  while (end > begin && isBlank(*(end - 1)))
+  {
+    --end;
+  }
+}
+
+bool parseIndex(const char* begin, const char* end, Eigen::Index& value)
+{
+  trim(begin, end);
+  if (begin == end)
+  {
+    return false;
+  }
+
+  value = 0;
+  for (const char* p = begin; p < end; ++p)
+  {
+    if (*p < '0' || *p > '9')
+    {
+      return false;
+    }
+    Eigen::Index digit = *p - '0';
+    if (value > (std::numeric_limits<Eigen::Index>::max() - digit) / 10)
+    {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  return true;
+}
+
+// Fast path for plain decimals whose digits, read as an integer, are below 2^53 and which have at
+// most 22 fractional digits: both the integer and the power of ten are exact doubles, so the one
+// division is correctly rounded. This covers the usual counts and timestamps, everything else
+// (exponents, longer mantissas, inf and nan) is handed to strtod. Hexadecimal numbers are rejected.
+bool parseNumber(const char* begin, const char* end, double& value)
+{
+  trim(begin, end);
+  if (begin == end)
+  {
+    return false;
+  }
+
+  const char* p = begin;
+  bool negative = (*p == '-');
+  if (*p == '-' || *p == '+')
+  {
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int digits        = 0;
+  int exponent      = 0;
+  bool fallback     = false;
+
+  for (; p < end && *p >= '0' && *p <= '9'; ++p)
+  {
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    fallback = fallback || (++digits > 19);
+  }
+  if (p < end && *p == '.')
+  {
+    for (++p; p < end && *p >= '0' && *p <= '9'; ++p)
+    {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+      fallback = fallback || (++digits > 19);
+      --exponent;
+    }
+  }
+
+  if (digits == 0 && p == end)
+  {
+    return false;
+  }
+
+  if (!fallback && p == end && mantissa < (uint64_t(1) << 53) && exponent >= -22)
+  {
+    value = static_cast<double>(mantissa) / POW10[-exponent];
+    value = negative ? -value : value;
+    return true;
+  }
+
+  if (std::find_if(begin, end, [](char c) { return c == 'x' || c == 'X'; }) != end)
+  {
+    return false;
+  }
+
+  // strtod needs a terminated copy, fields too long for the stack buffer are copied to the heap
+  char buffer[64];
+  std::string long_field;
+  const char* text = buffer;
+  size_t length    = static_cast<size_t>(end - begin);
+  if (length < sizeof(buffer))
+  {
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+  }
+  else
+  {
+    long_field.assign(begin, end);
+    text = long_field.c_str();
+  }
+
+  char* parsed_end;
+  value = std::strtod(text, &parsed_end);
+  return parsed_end == text + length;
+}
+
+[[noreturn]] void malformed(const char* base, const char* line)
+{
+  throw std::runtime_error("Malformed evidence line at byte offset " +
+                           std::to_string(line - base) + "!");
+}
+
+void parseChunk(const char* base,
+                const char* begin,
+                const char* end,
+                Eigen::Index dimensions,
+                char delimiter,
+                PartialEvidence& partial)
+{
+  const char* line = begin;
+
+  while (line < end)
+  {
+    // Field i starts at fields[i] and ends before the next delimiter or line_end
+    const char* fields[5] = {};
+    int count       = 0;
+    fields[count++] = line;
+    const char* p   = line;
+    for (; p < end && *p != '\n'; ++p)
+    {
+      if (*p == delimiter && count < 5)
+      {
+        fields[count++] = p + 1;
+      }
+    }
+    const char* line_end = p;
+
+    const char* id_begin = line;
+    const char* id_end   = (count > 1) ? fields[1] - 1 : line_end;
+    trim(id_begin, id_end);
+
+    if (count == 1 && id_begin == id_end)
+    {
+      // Empty line
+      line = line_end + 1;
+      continue;
+    }
+
+    Eigen::Index category;
+    double evidence;
+    double timestamp = 0.0;
+
+    if (count < 3 || count > 4 || id_begin == id_end ||
+        !parseIndex(fields[1], fields[2] - 1, category) ||
+        !parseNumber(fields[2], (count > 3) ? fields[3] - 1 : line_end, evidence) ||
+        (count > 3 && !parseNumber(fields[3], line_end, timestamp)) || category >= dimensions ||
+        !std::isfinite(evidence) || evidence < 0.0 || !std::isfinite(timestamp))
+    {
+      malformed(base, line);
+    }
+
+    std::pair<size_t, bool> row = partial.index.insert(id_begin, id_end - id_begin);
+    if (row.second)
+    {
+      partial.rows.resize(partial.rows.size() + dimensions + 1, 0.0);
+      partial.rows.back() = timestamp;
+    }
+
+    double* values = &partial.rows[row.first * (dimensions + 1)];
+    values[category] += evidence;
+    values[dimensions] = std::max(values[dimensions], timestamp);
+
+    line = line_end + 1;
+  }
+}
+
+struct MappedFile
+{
+  MappedFile(const std::string& path)
+  {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      throw std::runtime_error("Could not open evidence file " + path + "!");
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+      ::close(fd);
+      throw std::runtime_error("Could not read evidence file " + path + "!");
+    }
+
+    size = static_cast<size_t>(st.st_size);
+    if (size > 0)
+    {
+      void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr == MAP_FAILED)
+      {
+        ::close(fd);
+        throw std::runtime_error("Could not map evidence file " + path + "!");
+      }
+      ::madvise(ptr, size, MADV_SEQUENTIAL);
+      data = static_cast<const char*>(ptr);
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile()
+  {
+    if (data != nullptr)
+    {
+      ::munmap(const_cast<char*>(data), size);
+    }
+  }
+
+  const char* data = nullptr;
+  size_t size      = 0;
+};
+
+} // namespace
+
+EvidenceTable ingestEvidence(const char* data,
+                             size_t size,
+                             Eigen::Index dimensions,
+                             char delimiter,
+                             bool skip_header)
+{
+  if (dimensions <= 0)
+  {
+    throw std::invalid_argument("Dimensions must be positive!");
+  }
+
+  const char* begin = data;
+  const char* end   = data + size;
+
+  if (skip_header && begin < end)
+  {
+    const char* header_end = static_cast<const char*>(std::memchr(begin, '\n', size));
+    begin                  = (header_end == nullptr) ? end : header_end + 1;
+  }
+
+  // One chunk per task of the executor, boundaries are moved behind the next line break
+  size_t chunks = detail::parallelPlan(static_cast<size_t>(end - begin), 1).tasks;
+  std::vector<const char*> bounds(chunks + 1, end);
+  bounds[0] = begin;
+  for (size_t c = 1; c < chunks; ++c)
+  {
+    const char* bound = std::max(bounds[c - 1], begin + (end - begin) * c / chunks);
+    if (bound > begin && bound < end && *(bound - 1) != '\n')
+    {
+      const char* next = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+      bound            = (next == nullptr) ? end : next + 1;
+    }
+    bounds[c] = bound;
+  }
+
+  std::vector<PartialEvidence> partials(chunks);
+  detail::parallelFor(
+    chunks,
+    [&](size_t first, size_t last) {
+      for (size_t c = first; c < last; ++c)
+      {
+        parseChunk(data, bounds[c], bounds[c + 1], dimensions, delimiter, partials[c]);
+      }
+    },
+    1);
+
+  // Merge the chunks in input order
+  KeyIndex index;
+  std::vector<double> rows;
+  Eigen::Index stride = dimensions + 1;
+
+  for (PartialEvidence& partial : partials)
+  {
+    for (size_t r = 0; r < partial.index.size(); ++r)
+    {
+      std::pair<size_t, bool> row =
+        index.insert(partial.index.keyData(r), partial.index.keyLength(r));
+      const double* values = &partial.rows[r * stride];
+      if (row.second)
+      {
+        rows.insert(rows.end(), values, values + stride);
+      }
+      else
+      {
+        double* merged = &rows[row.first * stride];
+        for (Eigen::Index j = 0; j < dimensions; ++j)
+        {
+          merged[j] += values[j];
+        }
+        merged[dimensions] = std::max(merged[dimensions], values[dimensions]);
+      }
+    }
+  }
+
+  EvidenceTable table;
+  Eigen::Index count = static_cast<Eigen::Index>(index.size());
+  table.keys.reserve(index.size());
+  for (size_t r = 0; r < index.size(); ++r)
+  {
+    table.keys.emplace_back(index.keyData(r), index.keyLength(r));
+  }
+  Eigen::Map<const BatchMatrix> merged(rows.data(), count, stride);
+  table.evidence  = merged.leftCols(dimensions);
+  table.timestamp = merged.col(dimensions);
+
+  return table;
+}
+
+EvidenceTable ingestEvidenceFile(const std::string& path,
+                                 Eigen::Index dimensions,
+                                 char delimiter,
+                                 bool skip_header)
+{
+  MappedFile file(path);
+  return ingestEvidence(file.data, file.size, dimensions, delimiter, skip_header);
+}
+
+OpinionBatch evidenceOpinionBatch(const EvidenceTable& table, const Eigen::VectorXd& base_rate)
+{
+  Eigen::Index rows = table.evidence.rows();
+  Eigen::Index dim  = table.evidence.cols();
+
+  if (base_rate.rows() != dim)
+  {
+    throw std::invalid_argument("Base rate must have the dimension of the evidence!");
+  }
+
+  double prior_weight = static_cast<double>(dim);
+  BatchVector norm    = (table.evidence.rowwise().sum().array() + prior_weight).matrix();
+
+  return OpinionBatch((table.evidence.array().colwise() / norm.array()).matrix(),
+                      (prior_weight / norm.array()).matrix(),
+                      base_rate.transpose().replicate(rows, 1));
+}
+
+std::vector<MultinomialOpinion> evidenceOpinions(const EvidenceTable& table,
+                                                 const Eigen::VectorXd& base_rate)
+{
+  OpinionBatch batch = evidenceOpinionBatch(table, base_rate);
+  std::vector<MultinomialOpinion> opinions;
+  opinions.reserve(table.keys.size());
+
+  for (Eigen::Index i = 0; i < table.evidence.rows(); ++i)
+  {
+    opinions.emplace_back(std::get<0>(batch).row(i).transpose(),
+                          std::get<1>(batch)(i),
+                          base_rate);
+  }
+
+  return opinions;
+}
+
+} // namespace subj
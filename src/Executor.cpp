@@ -0,0 +1,456 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/Executor.h>
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace subj {
+namespace detail {
+
+class WorkStealingPool
+{
+public:
+  explicit WorkStealingPool(size_t workers);
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  ~WorkStealingPool();
+
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  void run(size_t count, const std::function<void(size_t)>& task);
+
+private:
+  struct Job
+  {
+    const std::function<void(size_t)>* task;
+    std::atomic<size_t> pending;
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+
+  struct Range
+  {
+    Job* job;
+    size_t begin;
+    size_t end;
+  };
+
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<Range> ranges;
+    // Keeps the mutexes of neighbouring queues off a shared cache line
+    char padding[64];
+  };
+
+  void work(size_t worker);
+  void wait(Job& job, size_t home);
+  void execute(size_t home, Range range);
+  void push(size_t queue, const Range& range);
+  bool pop(size_t queue, Range& range);
+  bool steal(size_t queue, Range& range);
+  bool find(size_t home, Range& range);
+
+  // Queue of the calling thread: its own one for workers, the shared last one for other threads.
+  size_t home() const;
+
+  size_t m_workers;
+  std::unique_ptr<Queue[]> m_queues;
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  // Number of queued ranges, may be off by the pushes and pops in progress
+  std::atomic<ptrdiff_t> m_queued;
+  bool m_stop;
+};
+
+} // namespace detail
+
+namespace {
+
+// Pool and queue index of the worker thread running on this thread, if any
+thread_local const detail::WorkStealingPool* t_pool = nullptr;
+thread_local size_t t_worker                         = 0;
+
+// Task limit of the ParallelScope of this thread
+thread_local size_t t_max_tasks = 0;
+
+size_t defaultThreadCount()
+{
+  const char* value = std::getenv("SUBJ_NUM_THREADS");
+  if (value != nullptr)
+  {
+    char* end           = nullptr;
+    unsigned long count = std::strtoul(value, &end, 10);
+    if (end != value && *end == '\0' && count > 0)
+    {
+      return static_cast<size_t>(count);
+    }
+  }
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+std::shared_ptr<Executor> createDefaultExecutor()
+{
+  size_t threads = defaultThreadCount();
+  if (threads == 1)
+  {
+    return std::make_shared<SerialExecutor>();
+  }
+  return std::make_shared<WorkStealingExecutor>(threads);
+}
+
+struct ExecutorState
+{
+  std::mutex mutex;
+  std::shared_ptr<Executor> executor;
+};
+
+ExecutorState& executorState()
+{
+  static ExecutorState state;
+  return state;
+}
+
+} // namespace
+
+namespace detail {
+
+WorkStealingPool::WorkStealingPool(size_t workers)
+  : m_workers(workers)
+  , m_queues(new Queue[workers + 1])
+  , m_queued(0)
+  , m_stop(false)
+{
+  m_threads.reserve(workers);
+  for (size_t worker = 0; worker < workers; ++worker)
+  {
+    m_threads.emplace_back(&WorkStealingPool::work, this, worker);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for (std::thread& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::run(size_t count, const std::function<void(size_t)>& task)
+{
+  if (count == 0)
+  {
+    return;
+  }
+
+  Job job;
+  job.task    = &task;
+  job.pending = count;
+
+  size_t queue = home();
+  execute(queue, Range{&job, 0, count});
+  wait(job, queue);
+
+  if (job.error)
+  {
+    std::rethrow_exception(job.error);
+  }
+}
+
+void WorkStealingPool::work(size_t worker)
+{
+  t_pool   = this;
+  t_worker = worker;
+
+  Range range;
+  for (;;)
+  {
+    if (find(worker, range))
+    {
+      execute(worker, range);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_wake.wait(lock, [this]() { return m_stop || m_queued.load() > 0; });
+    if (m_stop && m_queued.load() <= 0)
+    {
+      return;
+    }
+  }
+}
+
+void WorkStealingPool::wait(Job& job, size_t home)
+{
+  Range range;
+  while (job.pending.load() != 0)
+  {
+    if (find(home, range))
+    {
+      execute(home, range);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_wake.wait(lock, [this, &job]() { return job.pending.load() == 0 || m_queued.load() > 0; });
+  }
+
+  // The wake up may have been meant for queued work this thread did not take
+  if (m_queued.load() > 0)
+  {
+    m_wake.notify_one();
+  }
+}
+
+void WorkStealingPool::execute(size_t home, Range range)
+{
+  while (range.end - range.begin > 1)
+  {
+    size_t middle = range.begin + (range.end - range.begin) / 2;
+    push(home, Range{range.job, middle, range.end});
+    range.end = middle;
+  }
+
+  Job& job = *range.job;
+  try
+  {
+    (*job.task)(range.begin);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(job.error_mutex);
+    if (!job.error)
+    {
+      job.error = std::current_exception();
+    }
+  }
+
+  // The job may be gone as soon as its last task is counted
+  if (job.pending.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wake.notify_all();
+  }
+}
+
+void WorkStealingPool::push(size_t queue, const Range& range)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_queues[queue].mutex);
+    m_queues[queue].ranges.push_back(range);
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_queued;
+  }
+  m_wake.notify_one();
+}
+
+bool WorkStealingPool::pop(size_t queue, Range& range)
+{
+  std::lock_guard<std::mutex> lock(m_queues[queue].mutex);
+  std::deque<Range>& ranges = m_queues[queue].ranges;
+  if (ranges.empty())
+  {
+    return false;
+  }
+  range = ranges.back();
+  ranges.pop_back();
+  --m_queued;
+  return true;
+}
+
+bool WorkStealingPool::steal(size_t queue, Range& range)
+{
+  std::lock_guard<std::mutex> lock(m_queues[queue].mutex);
+  std::deque<Range>& ranges = m_queues[queue].ranges;
+  if (ranges.empty())
+  {
+    return false;
+  }
+  range = ranges.front();
+  ranges.pop_front();
+  --m_queued;
+  return true;
+}
+
+bool WorkStealingPool::find(size_t home, Range& range)
+{
+  if (pop(home, range))
+  {
+    return true;
+  }
+  size_t queues = m_workers + 1;
+  for (size_t i = 1; i < queues; ++i)
+  {
+    if (steal((home + i) % queues, range))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t WorkStealingPool::home() const
+{
+  return (t_pool == this) ? t_worker : m_workers;
+}
+
+ParallelPlan parallelPlan(size_t count, size_t grain)
+{
+  ParallelPlan plan = {nullptr, 1};
+  size_t limit      = t_max_tasks;
+  if (limit == 1)
+  {
+    return plan;
+  }
+
+  plan.executor      = executor();
+  size_t concurrency = plan.executor->concurrency();
+  if (concurrency <= 1)
+  {
+    return plan;
+  }
+
+  size_t tasks = (count + grain - 1) / std::max<size_t>(1, grain);
+  tasks        = std::min(tasks, concurrency * PARALLEL_TASKS_PER_THREAD);
+  if (limit > 0)
+  {
+    tasks = std::min(tasks, limit);
+  }
+  plan.tasks = std::max<size_t>(1, tasks);
+  return plan;
+}
+
+} // namespace detail
+
+size_t SerialExecutor::concurrency() const
+{
+  return 1;
+}
+
+void SerialExecutor::run(size_t count, const std::function<void(size_t)>& task)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    task(i);
+  }
+}
+
+WorkStealingExecutor::WorkStealingExecutor(size_t threads)
+  : m_threads(threads > 0 ? threads : std::max<size_t>(1, std::thread::hardware_concurrency()))
+  , m_pool(new detail::WorkStealingPool(m_threads - 1))
+{
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() = default;
+
+size_t WorkStealingExecutor::concurrency() const
+{
+  return m_threads;
+}
+
+void WorkStealingExecutor::run(size_t count, const std::function<void(size_t)>& task)
+{
+  m_pool->run(count, task);
+}
+
+std::shared_ptr<Executor> defaultExecutor()
+{
+  static const std::shared_ptr<Executor> executor = createDefaultExecutor();
+  return executor;
+}
+
+std::shared_ptr<Executor> executor()
+{
+  {
+    ExecutorState& state = executorState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.executor)
+    {
+      return state.executor;
+    }
+  }
+  return defaultExecutor();
+}
+
+void setExecutor(std::shared_ptr<Executor> executor)
+{
+  ExecutorState& state = executorState();
+  std::shared_ptr<Executor> previous;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    previous.swap(state.executor);
+    state.executor = std::move(executor);
+  }
+  // An executor released here shuts its threads down outside the lock
+}
+
+ParallelScope::ParallelScope(size_t max_tasks)
+  : m_previous(t_max_tasks)
+{
+  t_max_tasks = max_tasks;
+}
+
+ParallelScope::~ParallelScope()
+{
+  t_max_tasks = m_previous;
+}
+
+size_t ParallelScope::maxTasks()
+{
+  return t_max_tasks;
+}
+
+} // namespace subj
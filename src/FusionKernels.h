@@ -0,0 +1,528 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#ifndef SUBJ_FUSION_KERNELS_H_INCLUDED
+#define SUBJ_FUSION_KERNELS_H_INCLUDED
+
+#include <subj/Batch.h>
+#include <subj/FusionMode.h>
+#include <subj/MultinomialOpinion.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace subj {
+namespace detail {
+
+// Sources of the N-ary fusion kernels, giving element access to N opinions of the same dimension
+// without copying them.
+class OpinionSpan
+{
+public:
+  OpinionSpan(const MultinomialOpinion* opinions, size_t size)
+    : m_opinions(opinions)
+    , m_size(static_cast<Eigen::Index>(size))
+  {
+  }
+
+  Eigen::Index size() const { return m_size; }
+  double uncertainty(Eigen::Index k) const { return m_opinions[k].u(); }
+  double belief(Eigen::Index k, Eigen::Index i) const
+  {
+    return OpinionAccess::belief(m_opinions[k])(i);
+  }
+  double baseRate(Eigen::Index k, Eigen::Index i) const
+  {
+    return OpinionAccess::baseRate(m_opinions[k])(i);
+  }
+
+private:
+  const MultinomialOpinion* m_opinions;
+  Eigen::Index m_size;
+};
+
+// The rows [begin, end) of a batch.
+class BatchSpan
+{
+public:
+  BatchSpan(const Eigen::Ref<const BatchMatrix>& belief,
+            const Eigen::Ref<const BatchVector>& uncertainty,
+            const Eigen::Ref<const BatchMatrix>& base_rate,
+            Eigen::Index begin,
+            Eigen::Index end)
+    : m_belief(belief)
+    , m_uncertainty(uncertainty)
+    , m_base_rate(base_rate)
+    , m_begin(begin)
+    , m_size(end - begin)
+  {
+  }
+
+  Eigen::Index size() const { return m_size; }
+  double uncertainty(Eigen::Index k) const { return m_uncertainty(m_begin + k); }
+  double belief(Eigen::Index k, Eigen::Index i) const { return m_belief(m_begin + k, i); }
+  double baseRate(Eigen::Index k, Eigen::Index i) const { return m_base_rate(m_begin + k, i); }
+
+private:
+  const Eigen::Ref<const BatchMatrix>& m_belief;
+  const Eigen::Ref<const BatchVector>& m_uncertainty;
+  const Eigen::Ref<const BatchMatrix>& m_base_rate;
+  Eigen::Index m_begin;
+  Eigen::Index m_size;
+};
+
+// Any of the above with every opinion trust discounted by its probability on access, such that
+// the discounted opinions are never materialized.
+template <typename Source>
+class DiscountedSource
+{
+public:
+  // One probability per opinion, or a single shared one if stride is 0.
+  DiscountedSource(const Source& source, const double* probability, Eigen::Index stride = 1)
+    : m_source(source)
+    , m_probability(probability)
+    , m_stride(stride)
+  {
+  }
+
+  Eigen::Index size() const { return m_source.size(); }
+  double uncertainty(Eigen::Index k) const
+  {
+    return 1.0 - probability(k) * (1.0 - m_source.uncertainty(k));
+  }
+  double belief(Eigen::Index k, Eigen::Index i) const
+  {
+    return probability(k) * m_source.belief(k, i);
+  }
+  double baseRate(Eigen::Index k, Eigen::Index i) const { return m_source.baseRate(k, i); }
+
+private:
+  double probability(Eigen::Index k) const { return m_probability[k * m_stride]; }
+
+  const Source& m_source;
+  const double* m_probability;
+  Eigen::Index m_stride;
+};
+
+// The kernels below write the fused belief of all opinions of the source into the given vector of
+// length dim, which may be a row of a batch, and return the fused uncertainty. The fused base rate
+// is computed separately, such that it can be skipped if all opinions share their base rate. The
+// kernels only use the outputs as temporary storage and do not allocate.
+
+// Base rate weighted by the confidence 1 - u of every opinion, the average base rate if all
+// opinions are vacuous. Base rate of weighted, consensus and compromise and belief constraint
+// fusion.
+template <typename Source, typename BaseRate>
+void confidenceWeightedBaseRate(const Source& source, Eigen::Index dim, BaseRate&& base_rate)
+{
+  double confidence_sum = 0.0;
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    confidence_sum += 1.0 - source.uncertainty(k);
+  }
+  bool all_vacuous = confidence_sum == 0.0;
+
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    base_rate(i) = 0.0;
+  }
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double weight = all_vacuous ? 1.0 : 1.0 - source.uncertainty(k);
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      base_rate(i) += weight * source.baseRate(k, i);
+    }
+  }
+  double norm = all_vacuous ? static_cast<double>(source.size()) : confidence_sum;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    base_rate(i) /= norm;
+  }
+}
+
+// Base rate of aleatory cumulative and averaging belief fusion, every base rate weighted by
+// (1 - u) / u. If some opinions are dogmatic, their base rates are averaged. Fusing only vacuous
+// opinions results in the first base rate for cumulative and the average one for averaging fusion.
+template <typename Source, typename BaseRate>
+void uncertaintyWeightedBaseRate(bool cumulative,
+                                 const Source& source,
+                                 Eigen::Index dim,
+                                 BaseRate&& base_rate)
+{
+  Eigen::Index dogmatic = 0;
+  double weight_sum     = 0.0;
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u = source.uncertainty(k);
+    if (u == 0.0)
+    {
+      ++dogmatic;
+    }
+    else
+    {
+      weight_sum += (1.0 - u) / u;
+    }
+  }
+
+  if (dogmatic == 0 && weight_sum == 0.0)
+  {
+    if (cumulative)
+    {
+      for (Eigen::Index i = 0; i < dim; ++i)
+      {
+        base_rate(i) = source.baseRate(0, i);
+      }
+      return;
+    }
+    confidenceWeightedBaseRate(source, dim, base_rate);
+    return;
+  }
+
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    base_rate(i) = 0.0;
+  }
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u      = source.uncertainty(k);
+    double weight = dogmatic > 0 ? (u == 0.0 ? 1.0 : 0.0) : (1.0 - u) / u;
+    if (weight == 0.0)
+    {
+      continue;
+    }
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      base_rate(i) += weight * source.baseRate(k, i);
+    }
+  }
+
+  double norm = dogmatic > 0 ? static_cast<double>(dogmatic) : weight_sum;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    base_rate(i) /= norm;
+  }
+}
+
+// Aleatory cumulative (cumulative == true) and averaging belief fusion. As for weightedFusion(),
+// the closed forms of aleatoryCumulativeBeliefFusion() and averagingBeliefFusion() are divided by
+// the product of all uncertainties, weighting every belief by 1 / u. If some opinions are
+// dogmatic, their beliefs are averaged. Fusing only vacuous opinions results in the first opinion
+// for cumulative and in a vacuous opinion for averaging fusion.
+template <typename Source, typename Belief>
+double uncertaintyWeightedFusion(bool cumulative,
+                                 const Source& source,
+                                 Eigen::Index dim,
+                                 Belief&& belief)
+{
+  Eigen::Index dogmatic = 0;
+  double inverse_sum    = 0.0;
+  bool all_vacuous      = true;
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u = source.uncertainty(k);
+    if (u == 0.0)
+    {
+      ++dogmatic;
+    }
+    else
+    {
+      inverse_sum += 1.0 / u;
+    }
+    all_vacuous = all_vacuous && (u == 1.0);
+  }
+
+  if (all_vacuous)
+  {
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief(i) = cumulative ? source.belief(0, i) : 0.0;
+    }
+    return cumulative ? source.uncertainty(0) : 1.0;
+  }
+
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) = 0.0;
+  }
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u      = source.uncertainty(k);
+    double weight = dogmatic > 0 ? (u == 0.0 ? 1.0 : 0.0) : 1.0 / u;
+    if (weight == 0.0)
+    {
+      continue;
+    }
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief(i) += weight * source.belief(k, i);
+    }
+  }
+
+  double size = static_cast<double>(source.size());
+  double norm = dogmatic > 0 ? static_cast<double>(dogmatic)
+                             : (cumulative ? inverse_sum - (size - 1.0) : inverse_sum);
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) /= norm;
+  }
+
+  if (dogmatic > 0)
+  {
+    return 0.0;
+  }
+  return cumulative ? 1.0 / norm : size / norm;
+}
+
+// Weighted belief fusion. Dividing the closed form by the product of all uncertainties weights
+// every opinion by (1 - u) / u, which does not underflow for many opinions. If some opinions are
+// dogmatic, their beliefs are averaged, fusing only vacuous opinions results in a vacuous opinion.
+template <typename Source, typename Belief>
+double weightedFusion(const Source& source, Eigen::Index dim, Belief&& belief)
+{
+  Eigen::Index dogmatic = 0;
+  double weight_sum     = 0.0;
+  double confidence_sum = 0.0;
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u = source.uncertainty(k);
+    if (u == 0.0)
+    {
+      ++dogmatic;
+    }
+    else
+    {
+      weight_sum += (1.0 - u) / u;
+    }
+    confidence_sum += 1.0 - u;
+  }
+
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) = 0.0;
+  }
+  if (confidence_sum == 0.0)
+  {
+    return 1.0;
+  }
+
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u      = source.uncertainty(k);
+    double weight = dogmatic > 0 ? (u == 0.0 ? 1.0 : 0.0) : (1.0 - u) / u;
+    if (weight == 0.0)
+    {
+      continue;
+    }
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief(i) += weight * source.belief(k, i);
+    }
+  }
+
+  double norm = dogmatic > 0 ? static_cast<double>(dogmatic) : weight_sum;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) /= norm;
+  }
+  return dogmatic > 0 ? 0.0 : confidence_sum / weight_sum;
+}
+
+// Belief constraint fusion. The harmony on every value is the product of (b(x) + u) over all
+// opinions minus the product of the uncertainties, the remaining mass is the conflict which is
+// normalized away. The products are rescaled by their maximum after every opinion, which cancels
+// out in the normalization and keeps them from underflowing. Throws std::runtime_error if the
+// opinions are totally conflicting.
+template <typename Source, typename Belief>
+double beliefConstraintFusion(const Source& source, Eigen::Index dim, Belief&& belief)
+{
+  double u_product = 1.0;
+  double scale     = 1.0;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) = 1.0;
+  }
+
+  for (Eigen::Index k = 0; k < source.size(); ++k)
+  {
+    double u       = source.uncertainty(k);
+    double maximum = 0.0;
+    u_product *= u * scale;
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief(i) *= (source.belief(k, i) + u) * scale;
+      maximum = std::max(maximum, belief(i));
+    }
+    scale = maximum > 0.0 ? 1.0 / maximum : 1.0;
+  }
+
+  double harmony = 0.0;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) -= u_product;
+    harmony += belief(i);
+  }
+  double norm = harmony + u_product;
+  if (!(norm > 0.0))
+  {
+    throw std::runtime_error("Belief constraint fusion of totally conflicting opinions!");
+  }
+
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) /= norm;
+  }
+  return u_product / norm;
+}
+
+// Consensus and compromise fusion. The consensus is the minimum belief of all opinions on every
+// value. The residual beliefs and uncertainties are combined as in beliefConstraintFusion(), but
+// instead of being normalized away, combinations of residues on different values form the
+// compromise on a composite value. A multinomial opinion cannot hold belief on composite values,
+// so that vague belief is turned into uncertainty. The compromise is scaled to the mass not
+// covered by the consensus and the product of the uncertainties.
+template <typename Source, typename Belief>
+double consensusAndCompromiseFusion(const Source& source, Eigen::Index dim, Belief&& belief)
+{
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief(i) = source.belief(0, i);
+  }
+  for (Eigen::Index k = 1; k < source.size(); ++k)
+  {
+    for (Eigen::Index i = 0; i < dim; ++i)
+    {
+      belief(i) = std::min(belief(i), source.belief(k, i));
+    }
+  }
+
+  double consensus = 0.0;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    consensus += belief(i);
+  }
+
+  // Every opinion has the same residual mass, dividing by it bounds the products by 1.
+  double residual = 1.0 - consensus;
+  if (residual > 0.0)
+  {
+    double u_product        = 1.0;
+    double scaled_u_product = 1.0;
+    for (Eigen::Index k = 0; k < source.size(); ++k)
+    {
+      u_product *= source.uncertainty(k);
+      scaled_u_product *= source.uncertainty(k) / residual;
+    }
+
+    if (scaled_u_product < 1.0)
+    {
+      double scale = (residual - u_product) / (1.0 - scaled_u_product);
+      for (Eigen::Index i = 0; i < dim; ++i)
+      {
+        double product = 1.0;
+        for (Eigen::Index k = 0; k < source.size(); ++k)
+        {
+          product *= (source.belief(k, i) - belief(i) + source.uncertainty(k)) / residual;
+        }
+        belief(i) += scale * (product - scaled_u_product);
+      }
+    }
+  }
+
+  double belief_sum = 0.0;
+  for (Eigen::Index i = 0; i < dim; ++i)
+  {
+    belief_sum += belief(i);
+  }
+  return std::max(0.0, 1.0 - belief_sum);
+}
+
+// Dispatches to the belief kernel of the fusion mode and returns the fused uncertainty.
+template <typename Source, typename Belief>
+double fuseBelief(FusionMode mode, const Source& source, Eigen::Index dim, Belief&& belief)
+{
+  switch (mode)
+  {
+    case FusionMode::CUMULATIVE:
+      return uncertaintyWeightedFusion(true, source, dim, belief);
+    case FusionMode::AVERAGING:
+      return uncertaintyWeightedFusion(false, source, dim, belief);
+    case FusionMode::WEIGHTED:
+      return weightedFusion(source, dim, belief);
+    case FusionMode::CONSENSUS_AND_COMPROMISE:
+      return consensusAndCompromiseFusion(source, dim, belief);
+    case FusionMode::BELIEF_CONSTRAINT:
+      return beliefConstraintFusion(source, dim, belief);
+  }
+  throw std::invalid_argument("Unknown fusion mode!");
+}
+
+// Computes the fused base rate of the fusion mode.
+template <typename Source, typename BaseRate>
+void fuseBaseRate(FusionMode mode, const Source& source, Eigen::Index dim, BaseRate&& base_rate)
+{
+  switch (mode)
+  {
+    case FusionMode::CUMULATIVE:
+    case FusionMode::AVERAGING:
+      uncertaintyWeightedBaseRate(mode == FusionMode::CUMULATIVE, source, dim, base_rate);
+      return;
+    default:
+      confidenceWeightedBaseRate(source, dim, base_rate);
+      return;
+  }
+}
+
+// Computes the fused belief and base rate and returns the fused uncertainty.
+template <typename Source, typename Belief, typename BaseRate>
+double fuse(FusionMode mode,
+            const Source& source,
+            Eigen::Index dim,
+            Belief&& belief,
+            BaseRate&& base_rate)
+{
+  double uncertainty = fuseBelief(mode, source, dim, belief);
+  fuseBaseRate(mode, source, dim, base_rate);
+  return uncertainty;
+}
+
+} // namespace detail
+} // namespace subj
+
+#endif /* SUBJ_FUSION_KERNELS_H_INCLUDED */
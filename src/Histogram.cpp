@@ -36,8 +36,33 @@
 
 #include "subj/Histogram.h"
 
+#include "NumericKernels.h"
+#include "Parallel.h"
+
+#include <stdexcept>
+#include <vector>
+
 namespace subj {
 
+namespace {
+
+// The binning kernel requires bins which are sorted and do not overlap, intervals set up by the
+// other constructors always are.
+bool sortedBins(const Eigen::Matrix<double, Eigen::Dynamic, 2>& intervals)
+{
+  for (Eigen::Index i = 0; i < intervals.rows(); ++i)
+  {
+    if (!(intervals(i, 0) <= intervals(i, 1)) ||
+        (i + 1 < intervals.rows() && !(intervals(i, 1) <= intervals(i + 1, 0))))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 Histogram::Histogram() {}
 
 // Histogram::Histogram(size_t interval_count)
@@ -76,6 +101,19 @@ Histogram::Histogram(size_t interval_count,
   insert(data);
 }
 
+Histogram::Histogram(const Eigen::Matrix<size_t, Eigen::Dynamic, 1>& histogram,
+                     const Eigen::Matrix<double, Eigen::Dynamic, 2>& intervals,
+                     size_t data_count)
+  : m_hist(histogram)
+  , m_ivls(intervals)
+  , m_data_count(data_count)
+{
+  if (m_hist.rows() != m_ivls.rows())
+  {
+    throw std::invalid_argument("Histogram and intervals must have the same number of bins!");
+  }
+}
+
 void Histogram::insert(double value)
 {
   m_hist[binIndex(value)]++;
@@ -90,10 +128,32 @@ void Histogram::insertIntoBin(size_t bin)
 
 void Histogram::insert(const Eigen::Matrix<double, Eigen::Dynamic, 1>& data)
 {
-  for (int i = 0; i < data.rows(); ++i)
+  if (m_ivls.rows() == 0 || !sortedBins(m_ivls))
+  {
+    for (int i = 0; i < data.rows(); ++i)
+    {
+      insert(data[i]);
+    }
+    return;
+  }
+
+  const detail::NumericKernels& kernels = detail::numericKernels();
+  std::vector<Eigen::Index> bins(static_cast<size_t>(data.rows()));
+  detail::parallelFor(bins.size(), [&](size_t begin, size_t end) {
+    kernels.histogramBins(m_ivls.col(0).data(),
+                          m_ivls.col(1).data(),
+                          m_ivls.rows(),
+                          data.data(),
+                          bins.data(),
+                          begin,
+                          end);
+  });
+
+  for (Eigen::Index bin : bins)
   {
-    insert(data[i]);
+    m_hist[bin]++;
   }
+  m_data_count += bins.size();
 }
 
 Eigen::Matrix<double, Eigen::Dynamic, 1> Histogram::normalizedHistogram() const
@@ -40,31 +40,31 @@ namespace subj {
 
 HyperOpinion::HyperOpinion() = default;
 
-HyperOpinion::HyperOpinion(const HyperOpinion::RVector& belief,
+HyperOpinion::HyperOpinion(const HyperOpinion::RVectorRef& belief,
                            const double& uncertainty,
-                           const HyperOpinion::DVector& base_rate)
+                           const HyperOpinion::DVectorRef& base_rate)
 {
   updateBelief(belief);
   updateUncertainty(uncertainty);
   updateBaseRate(base_rate);
 }
 
-void HyperOpinion::update(const HyperOpinion::RVector& belief,
+void HyperOpinion::update(const HyperOpinion::RVectorRef& belief,
                           const double& uncertainty,
-                          const HyperOpinion::DVector& base_rate)
+                          const HyperOpinion::DVectorRef& base_rate)
 {
   updateBelief(belief);
   updateUncertainty(uncertainty);
   updateBaseRate(base_rate);
 }
 
-void HyperOpinion::updateBelief(const HyperOpinion::RVector& belief)
+void HyperOpinion::updateBelief(const HyperOpinion::RVectorRef& belief)
 {
   m_belief       = belief;
   m_prior_weight = ((int)std::pow(2, belief.rows())) - 2;
 }
 
-HyperOpinion::RVector HyperOpinion::belief() const
+const HyperOpinion::RVector& HyperOpinion::belief() const
 {
   return m_belief;
 }
@@ -79,12 +79,12 @@ double HyperOpinion::uncertainty() const
   return m_uncertainty;
 }
 
-void HyperOpinion::updateBaseRate(const HyperOpinion::DVector& base_rate)
+void HyperOpinion::updateBaseRate(const HyperOpinion::DVectorRef& base_rate)
 {
   m_base_rate = base_rate;
 }
 
-HyperOpinion::DVector HyperOpinion::baseRate() const
+const HyperOpinion::DVector& HyperOpinion::baseRate() const
 {
   return m_base_rate;
 }
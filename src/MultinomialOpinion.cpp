@@ -38,18 +38,48 @@
 #include <subj/MultinomialOpinion.h>
 #include <subj/OpinionOwner.h>
 
+#ifndef SUBJ_INLINE_ACCESSORS
+#include <subj/MultinomialOpinion.inl>
+#endif
+
 #include <Eigen/Dense>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 namespace subj {
 
+namespace {
+
+// Dimensions below which every thread keeps the uniform base rate of each dimension.
+const Eigen::Index UNIFORM_CACHE_SIZE = 64;
+
+// Uniform base rate shared by the opinions a thread constructs by dimension. The handles belong
+// to the thread, such that constructing opinions neither locks the registry nor contends on a
+// reference count with other threads. Larger dimensions are cached for the last one requested.
+const BaseRateHandle& uniformBaseRate(const Eigen::Index& dimensions)
+{
+  static thread_local std::vector<BaseRateHandle> small(UNIFORM_CACHE_SIZE);
+  static thread_local BaseRateHandle large;
+
+  BaseRateHandle& uniform = (dimensions < UNIFORM_CACHE_SIZE) ? small[dimensions] : large;
+  if (!uniform || uniform->size() != dimensions)
+  {
+    uniform = std::make_shared<const MultinomialOpinion::Vector>(
+      MultinomialOpinion::Vector::Constant(dimensions, 1.0 / static_cast<double>(dimensions)));
+  }
+  return uniform;
+}
+
+} // namespace
+
 MultinomialOpinion::MultinomialOpinion(const uint32_t& dimensions)
 {
   // Check dimensions > 0!
   m_dim          = dimensions;
   m_belief       = Eigen::VectorXd::Zero(dimensions);
-  m_base_rate    = Eigen::VectorXd::Constant(dimensions, 1.0 / dimensions);
+  m_base_rate    = uniformBaseRate(dimensions);
   m_uncertainty  = 1.0;
   m_prior_weight = dimensions;
 }
@@ -72,13 +102,25 @@ MultinomialOpinion::MultinomialOpinion(const std::vector<double>& belief,
 {
 }
 
-MultinomialOpinion::MultinomialOpinion(const MultinomialOpinion::Vector& belief,
+MultinomialOpinion::MultinomialOpinion(const MultinomialOpinion::VectorRef& belief,
                                        const double& uncertainty,
-                                       const MultinomialOpinion::Vector& base_rate)
+                                       const MultinomialOpinion::VectorRef& base_rate)
 {
   update(belief, uncertainty, base_rate);
 }
 
+MultinomialOpinion::MultinomialOpinion(const MultinomialOpinion::VectorRef& belief,
+                                       const double& uncertainty,
+                                       const BaseRateHandle& base_rate)
+{
+  updateBelief(belief);
+  updateUncertainty(uncertainty);
+  if (!updateBaseRate(base_rate))
+  {
+    throw std::invalid_argument("The base rate does not match the dimension of the belief!");
+  }
+}
+
 bool MultinomialOpinion::update(const std::initializer_list<double>& belief,
                                 const double& uncertainty,
                                 const std::initializer_list<double>& base_rate)
@@ -97,9 +139,9 @@ bool MultinomialOpinion::update(const std::vector<double>& belief,
                                                         (Eigen::Index)base_rate.size()));
 }
 
-bool MultinomialOpinion::update(const MultinomialOpinion::Vector& belief,
+bool MultinomialOpinion::update(const MultinomialOpinion::VectorRef& belief,
                                 const double& uncertainty,
-                                const MultinomialOpinion::Vector& base_rate)
+                                const MultinomialOpinion::VectorRef& base_rate)
 {
   bool b = updateBelief(belief);
   bool u = updateUncertainty(uncertainty);
@@ -118,8 +160,9 @@ bool MultinomialOpinion::updateBelief(const std::vector<double>& belief)
     belief.data(), (Eigen::Index)belief.size()));
 }
 
-bool MultinomialOpinion::updateBelief(const MultinomialOpinion::Vector& belief)
+bool MultinomialOpinion::updateBelief(const MultinomialOpinion::VectorRef& belief)
 {
+  invalidateCache();
   Eigen::Index rows = belief.rows();
   Eigen::Index cols = belief.cols();
 
@@ -160,62 +203,11 @@ bool MultinomialOpinion::b(const std::vector<double>& belief)
                                                                (Eigen::Index)belief.size()));
 }
 
-bool MultinomialOpinion::b(const MultinomialOpinion::Vector& belief)
+bool MultinomialOpinion::b(const MultinomialOpinion::VectorRef& belief)
 {
   return updateBelief(belief);
 }
 
-std::vector<double> MultinomialOpinion::belief() const
-{
-  return std::vector<double>(m_belief.data(), m_belief.data() + m_belief.size());
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::beliefMat() const
-{
-  return m_belief;
-}
-
-std::vector<double> MultinomialOpinion::b() const
-{
-  return belief();
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::bMat() const
-{
-  return beliefMat();
-}
-
-bool MultinomialOpinion::updateUncertainty(const double& uncertainty)
-{
-  double sum = m_belief.sum();
-
-  if ((sum + uncertainty) == 1)
-  {
-    m_uncertainty = uncertainty;
-  }
-  else
-  {
-    m_uncertainty = 1 - m_belief.sum();
-  }
-
-  return true;
-}
-
-bool MultinomialOpinion::u(const double& uncertainty)
-{
-  return updateUncertainty(uncertainty);
-}
-
-double MultinomialOpinion::uncertainty() const
-{
-  return m_uncertainty;
-}
-
-double MultinomialOpinion::u() const
-{
-  return uncertainty();
-}
-
 bool MultinomialOpinion::updateBaseRate(const std::initializer_list<double>& base_rate)
 {
   return updateBaseRate(std::vector<double>(base_rate));
@@ -227,7 +219,7 @@ bool MultinomialOpinion::updateBaseRate(const std::vector<double>& base_rate)
     base_rate.data(), (Eigen::Index)base_rate.size()));
 }
 
-bool MultinomialOpinion::updateBaseRate(const MultinomialOpinion::Vector& base_rate)
+bool MultinomialOpinion::updateBaseRate(const MultinomialOpinion::VectorRef& base_rate)
 {
   Eigen::Index rows = base_rate.rows();
   Eigen::Index cols = base_rate.cols();
@@ -236,12 +228,12 @@ bool MultinomialOpinion::updateBaseRate(const MultinomialOpinion::Vector& base_r
   {
     if (m_dim < 0)
     {
-      m_dim       = rows;
-      m_base_rate = base_rate;
+      m_dim             = rows;
+      mutableBaseRate() = base_rate;
     }
     else if (m_dim == rows)
     {
-      m_base_rate = base_rate;
+      mutableBaseRate() = base_rate;
     }
     else
     {
@@ -257,6 +249,22 @@ bool MultinomialOpinion::updateBaseRate(const MultinomialOpinion::Vector& base_r
   return true;
 }
 
+bool MultinomialOpinion::updateBaseRate(const BaseRateHandle& base_rate)
+{
+  if (!base_rate || (m_dim >= 0 && base_rate->size() != m_dim))
+  {
+    return false;
+  }
+  if (m_dim < 0)
+  {
+    m_dim = base_rate->size();
+  }
+  invalidateCache();
+  m_base_rate      = base_rate;
+  m_owns_base_rate = false;
+  return true;
+}
+
 bool MultinomialOpinion::a(const std::initializer_list<double>& base_rate)
 {
   return a(std::vector<double>(base_rate));
@@ -268,59 +276,22 @@ bool MultinomialOpinion::a(const std::vector<double>& base_rate)
                                                                (Eigen::Index)base_rate.size()));
 }
 
-bool MultinomialOpinion::a(const MultinomialOpinion::Vector& base_rate)
+bool MultinomialOpinion::a(const MultinomialOpinion::VectorRef& base_rate)
 {
   return updateBaseRate(base_rate);
 }
 
-std::vector<double> MultinomialOpinion::baseRate() const
-{
-  return std::vector<double>(m_base_rate.data(), m_base_rate.data() + m_base_rate.size());
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::baseRateMat() const
-{
-  return m_base_rate;
-}
-
-std::vector<double> MultinomialOpinion::a() const
+void MultinomialOpinion::internBaseRate()
 {
-  return baseRate();
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::aMat() const
-{
-  return baseRateMat();
-}
-
-OpinionOwner MultinomialOpinion::owner() const
-{
-  return m_owner;
-}
-
-void MultinomialOpinion::updateOwner(const OpinionOwner& owner)
-{
-  m_owner = owner;
+  m_base_rate      = BaseRateRegistry::global().intern(*m_base_rate);
+  m_owns_base_rate = false;
 }
 
 DirichletPDF MultinomialOpinion::dirichletPdf() const
 {
   DirichletPDF dp;
-  MultinomialOpinion::Vector r;
-
-  if (m_uncertainty != 0)
-  {
-    r = (m_prior_weight * m_belief) / m_uncertainty;
-    // TODO assertion 1 = m_uncertainty + m_belief.sum();
-  }
-  else
-  {
-    r = m_belief * std::numeric_limits<double>::infinity();
-    // TODO assertion 1 = m_belief.sum();
-  }
-
-  dp.updateEvidence(r);
-  dp.updateBaseRate(m_base_rate);
+  dp.updateEvidence(evidenceMat());
+  dp.updateBaseRate(*m_base_rate);
 
   return dp;
 }
@@ -332,67 +303,25 @@ DirichletPDF MultinomialOpinion::dir() const
 
 void MultinomialOpinion::update(DirichletPDF& pdf)
 {
+  invalidateCache();
   Eigen::VectorXd evidMat = pdf.evidenceMat();
   double evidence_sum     = evidMat.sum();
-  m_base_rate             = pdf.baseRateMat();
+  mutableBaseRate()       = pdf.baseRateMat();
   m_prior_weight =
-    static_cast<double>(m_base_rate.rows()); // TODO handle loss of precision for large values
+    static_cast<double>(m_base_rate->rows()); // TODO handle loss of precision for large values
   m_belief      = evidMat / (m_prior_weight + evidence_sum);
   m_dim         = m_belief.rows();
   m_uncertainty = m_prior_weight / (m_prior_weight + evidence_sum);
 }
 
-std::vector<double> MultinomialOpinion::projection() const
-{
-  MultinomialOpinion::Vector projMat = projectionMat();
-  return std::vector<double>(projMat.data(), projMat.data() + projMat.size());
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::projectionMat() const
-{
-  return m_belief + (m_base_rate * m_uncertainty);
-}
-
-std::vector<double> MultinomialOpinion::p() const
-{
-  return projection();
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::pMat() const
-{
-  return projectionMat();
-}
-
-std::vector<double> MultinomialOpinion::variance() const
-{
-  MultinomialOpinion::Vector varMat = varianceMat();
-  return std::vector<double>(varMat.data(), varMat.data() + varMat.size());
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::varianceMat() const
-{
-  MultinomialOpinion::Vector p = projectionMat();
-  return (p.array() * (1 - p.array()) * m_uncertainty) / (m_prior_weight * m_uncertainty);
-}
-
-std::vector<double> MultinomialOpinion::var() const
-{
-  return variance();
-}
-
-MultinomialOpinion::Vector MultinomialOpinion::varMat() const
-{
-  return varianceMat();
-}
-
 double MultinomialOpinion::uncertaintyMaximum() const
 {
-  double min_u                 = 1.0;
-  MultinomialOpinion::Vector p = projectionMat();
+  double min_u                        = 1.0;
+  const MultinomialOpinion::Vector& p = projectionMat();
 
   for (int i = 0; i < Eigen::Dynamic; ++i)
   {
-    double u = p(i) / m_base_rate(i);
+    double u = p(i) / (*m_base_rate)(i);
     if (u < min_u)
     {
       min_u = u;
@@ -414,10 +343,10 @@ std::ostream& operator<<(std::ostream& os, const MultinomialOpinion& opinion)
     os << ", " << opinion.m_belief(i);
   }
 
-  os << "), u=" << opinion.m_uncertainty << ", a=(" << opinion.m_base_rate(0);
-  for (int i = 1; i < opinion.m_base_rate.rows(); ++i)
+  os << "), u=" << opinion.m_uncertainty << ", a=(" << (*opinion.m_base_rate)(0);
+  for (int i = 1; i < opinion.m_base_rate->rows(); ++i)
   {
-    os << ", " << opinion.m_base_rate(i);
+    os << ", " << (*opinion.m_base_rate)(i);
   }
 
   os << "))";
@@ -425,9 +354,21 @@ std::ostream& operator<<(std::ostream& os, const MultinomialOpinion& opinion)
   return os;
 }
 
-Eigen::Index MultinomialOpinion::dim() const
+MultinomialOpinion::Vector& MultinomialOpinion::mutableBaseRate()
 {
-  return m_dim;
+  invalidateCache();
+  if (!m_base_rate)
+  {
+    m_base_rate = std::make_shared<Vector>();
+  }
+  else if (!m_owns_base_rate || m_base_rate.use_count() != 1)
+  {
+    m_base_rate = std::make_shared<Vector>(*m_base_rate);
+  }
+  m_owns_base_rate = true;
+  // The vector was allocated as mutable above or before, by this opinion or the one it was copied
+  // from, and no other opinion holds it.
+  return const_cast<Vector&>(*m_base_rate);
 }
 
 
@@ -0,0 +1,94 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include "NumericKernels.h"
+
+#include "BinomialKernels.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <initializer_list>
+
+// The levels are compiled with function target attributes instead of per-file -march flags: all
+// inline functions of other headers keep their baseline copies, only the kernels themselves (and
+// what gets inlined into them) use the instructions of their level.
+
+namespace subj {
+namespace detail {
+
+namespace baseline {
+#define SUBJ_KERNEL_TARGET
+#include "NumericKernels.inl"
+#undef SUBJ_KERNEL_TARGET
+} // namespace baseline
+
+#ifdef SUBJ_X86_KERNELS
+namespace avx2 {
+#  define SUBJ_KERNEL_TARGET __attribute__((target("avx2,fma")))
+#  include "NumericKernels.inl"
+#  undef SUBJ_KERNEL_TARGET
+} // namespace avx2
+
+namespace avx512 {
+#  define SUBJ_KERNEL_TARGET                                                                     \
+    __attribute__((target("avx2,fma,avx512f,avx512dq,avx512bw,avx512vl")))
+#  include "NumericKernels.inl"
+#  undef SUBJ_KERNEL_TARGET
+} // namespace avx512
+#endif
+
+const NumericKernels& numericKernels(IsaLevel level)
+{
+#ifdef SUBJ_X86_KERNELS
+  switch (level)
+  {
+    case IsaLevel::AVX512:
+      return avx512::KERNELS;
+    case IsaLevel::AVX2:
+      return avx2::KERNELS;
+    case IsaLevel::BASELINE:
+      break;
+  }
+#else
+  (void)level;
+#endif
+  return baseline::KERNELS;
+}
+
+} // namespace detail
+} // namespace subj
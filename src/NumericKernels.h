@@ -0,0 +1,171 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_NUMERIC_KERNELS_H_INCLUDED
+#define SUBJ_NUMERIC_KERNELS_H_INCLUDED
+
+#include <subj/Dispatch.h>
+
+#include <Eigen/Core>
+
+// Kernels for the x86 levels above BASELINE are compiled with GCC and Clang only.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define SUBJ_X86_KERNELS
+#endif
+
+namespace subj {
+namespace detail {
+
+// Strided array views handed to the kernels, e.g. taken from BatchVectorIn and BatchVectorOut.
+struct ArrayIn
+{
+  const double* data;
+  Eigen::Index stride;
+};
+
+struct ArrayOut
+{
+  double* data;
+  Eigen::Index stride;
+};
+
+// Binomial opinions given as separate belief, disbelief, uncertainty and base rate arrays.
+struct BinomialArraysIn
+{
+  ArrayIn b;
+  ArrayIn d;
+  ArrayIn u;
+  ArrayIn a;
+};
+
+struct BinomialArraysOut
+{
+  ArrayOut b;
+  ArrayOut d;
+  ArrayOut u;
+  ArrayOut a;
+};
+
+// Opinions of dimension dim given as row-major belief and base rate rows with the given row
+// strides and contiguous uncertainties, as stored in a batch.
+struct OpinionRows
+{
+  const double* belief;
+  Eigen::Index belief_stride;
+  const double* uncertainty;
+  const double* base_rate;
+  Eigen::Index base_rate_stride;
+  Eigen::Index dim;
+};
+
+// Table of the numeric kernels compiled for one instruction set level. The kernels process the
+// elements or rows [begin, end) and give bit-identical results on every level.
+struct NumericKernels
+{
+  void (*binomialAveragingFusion)(const BinomialArraysIn& x,
+                                  const BinomialArraysIn& y,
+                                  const BinomialArraysOut& out,
+                                  Eigen::Index begin,
+                                  Eigen::Index end);
+  void (*binomialCumulativeFusion)(const BinomialArraysIn& x,
+                                   const BinomialArraysIn& y,
+                                   const BinomialArraysOut& out,
+                                   Eigen::Index begin,
+                                   Eigen::Index end);
+  void (*binomialTrustDiscounting)(const BinomialArraysIn& x,
+                                   const ArrayIn& discount_probability,
+                                   const BinomialArraysOut& out,
+                                   Eigen::Index begin,
+                                   Eigen::Index end);
+  void (*binomialProjection)(const BinomialArraysIn& x,
+                             const ArrayOut& projection,
+                             Eigen::Index begin,
+                             Eigen::Index end);
+  void (*binomialVariance)(const BinomialArraysIn& x,
+                           const ArrayOut& variance,
+                           Eigen::Index begin,
+                           Eigen::Index end);
+  void (*binomialDegreeOfConflict)(const BinomialArraysIn& x,
+                                   const BinomialArraysIn& y,
+                                   const ArrayOut& conflict,
+                                   Eigen::Index begin,
+                                   Eigen::Index end);
+
+  // Writes the projected probabilities of the rows into projection (row stride projection_stride).
+  void (*projection)(const OpinionRows& x,
+                     double* projection,
+                     Eigen::Index projection_stride,
+                     Eigen::Index begin,
+                     Eigen::Index end);
+  void (*projectedDistance)(const OpinionRows& x,
+                            const OpinionRows& y,
+                            double* distance,
+                            Eigen::Index begin,
+                            Eigen::Index end);
+
+  // Bin indices of the values as Histogram::binIndex() computes them, for bins given by their
+  // lower and upper bounds which must be sorted and must not overlap.
+  void (*histogramBins)(const double* lower,
+                        const double* upper,
+                        Eigen::Index bins,
+                        const double* values,
+                        Eigen::Index* index,
+                        Eigen::Index begin,
+                        Eigen::Index end);
+
+  // Dirichlet log densities of the rows of x (row stride x_stride), given the strength minus one
+  // per dimension and the log of the normalization constant.
+  void (*dirichletLogDensity)(const double* x,
+                              Eigen::Index x_stride,
+                              Eigen::Index dim,
+                              const double* alpha_minus_one,
+                              double log_normalization,
+                              double* log_density,
+                              Eigen::Index begin,
+                              Eigen::Index end);
+};
+
+// Kernels compiled for the given level, which must be supported by the CPU.
+const NumericKernels& numericKernels(IsaLevel level);
+
+// Kernels of the level currently selected, see isaLevel(). Batched entry points look them up
+// once per call.
+const NumericKernels& numericKernels();
+
+} // namespace detail
+} // namespace subj
+
+#endif /* SUBJ_NUMERIC_KERNELS_H_INCLUDED */
@@ -0,0 +1,583 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+// Bodies of the numeric kernels, included by NumericKernels.cpp once per instruction set level into
+// a namespace of that level, with SUBJ_KERNEL_TARGET set to the target attribute of the level.
+// Everything has internal linkage, so the copies of the levels never replace each other when
+// linking. Deliberately without include guard.
+
+namespace {
+
+// Elements per block of the general paths, which gather strided arrays into local blocks and
+// compute into a local block, so the compute loops vectorize whatever the strides and overlaps.
+const Eigen::Index BLOCK = 128;
+
+struct BinomialBlock
+{
+  double b[BLOCK];
+  double d[BLOCK];
+  double u[BLOCK];
+  double a[BLOCK];
+};
+
+// Elements [begin, begin + n) of binomial arrays, pointing into the arrays if they are contiguous
+// and into the block the strided arrays are gathered into otherwise.
+struct BinomialView
+{
+  const double* b;
+  const double* d;
+  const double* u;
+  const double* a;
+};
+
+SUBJ_KERNEL_TARGET const double* view(const ArrayIn& in,
+                                      Eigen::Index begin,
+                                      Eigen::Index n,
+                                      double* block)
+{
+  if (in.stride == 1)
+  {
+    return in.data + begin;
+  }
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    block[i] = in.data[(begin + i) * in.stride];
+  }
+  return block;
+}
+
+SUBJ_KERNEL_TARGET BinomialView view(const BinomialArraysIn& in,
+                                     Eigen::Index begin,
+                                     Eigen::Index n,
+                                     BinomialBlock& block)
+{
+  return {view(in.b, begin, n, block.b),
+          view(in.d, begin, n, block.d),
+          view(in.u, begin, n, block.u),
+          view(in.a, begin, n, block.a)};
+}
+
+SUBJ_KERNEL_TARGET BinomialValues valuesAt(const BinomialView& x, Eigen::Index i)
+{
+  return {x.b[i], x.d[i], x.u[i], x.a[i]};
+}
+
+SUBJ_KERNEL_TARGET void storeAt(const BinomialValues& x, BinomialBlock& block, Eigen::Index i)
+{
+  block.b[i] = x.b;
+  block.d[i] = x.d;
+  block.u[i] = x.u;
+  block.a[i] = x.a;
+}
+
+SUBJ_KERNEL_TARGET void scatter(const double* in,
+                                Eigen::Index n,
+                                const ArrayOut& out,
+                                Eigen::Index begin)
+{
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    out.data[(begin + i) * out.stride] = in[i];
+  }
+}
+
+SUBJ_KERNEL_TARGET void scatter(const BinomialBlock& in,
+                                Eigen::Index n,
+                                const BinomialArraysOut& out,
+                                Eigen::Index begin)
+{
+  scatter(in.b, n, out.b, begin);
+  scatter(in.d, n, out.d, begin);
+  scatter(in.u, n, out.u, begin);
+  scatter(in.a, n, out.a, begin);
+}
+
+SUBJ_KERNEL_TARGET bool contiguous(const BinomialArraysIn& x)
+{
+  return x.b.stride == 1 && x.d.stride == 1 && x.u.stride == 1 && x.a.stride == 1;
+}
+
+// Whether the elements [begin, end) of the four outputs are contiguous and overlap neither each
+// other nor the elements of the inputs. Only then the restrict qualified fast paths are taken.
+SUBJ_KERNEL_TARGET bool separate(const BinomialArraysOut& out,
+                                 std::initializer_list<const double*> inputs,
+                                 Eigen::Index begin,
+                                 Eigen::Index end)
+{
+  if (out.b.stride != 1 || out.d.stride != 1 || out.u.stride != 1 || out.a.stride != 1)
+  {
+    return false;
+  }
+  const double* outputs[] = {out.b.data, out.d.data, out.u.data, out.a.data};
+  auto overlap            = [begin, end](const double* x, const double* y) {
+    return std::less<const double*>()(x + begin, y + end) &&
+           std::less<const double*>()(y + begin, x + end);
+  };
+  for (size_t i = 0; i < 4; ++i)
+  {
+    for (size_t j = 0; j < i; ++j)
+    {
+      if (overlap(outputs[i], outputs[j]))
+      {
+        return false;
+      }
+    }
+    for (const double* input : inputs)
+    {
+      if (overlap(outputs[i], input))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Operators of the element-wise binomial kernels, see BinomialKernels.h.
+struct AveragingFusion
+{
+  SUBJ_KERNEL_TARGET BinomialValues operator()(const BinomialValues& x,
+                                               const BinomialValues& y) const
+  {
+    return binomialAveragingFusion(x, y);
+  }
+};
+
+struct CumulativeFusion
+{
+  SUBJ_KERNEL_TARGET BinomialValues operator()(const BinomialValues& x,
+                                               const BinomialValues& y) const
+  {
+    return binomialCumulativeFusion(x, y);
+  }
+};
+
+struct DegreeOfConflict
+{
+  SUBJ_KERNEL_TARGET double operator()(const BinomialValues& x, const BinomialValues& y) const
+  {
+    return binomialDegreeOfConflict(x, y);
+  }
+};
+
+struct Projection
+{
+  SUBJ_KERNEL_TARGET double operator()(const BinomialValues& x) const
+  {
+    return binomialProjection(x);
+  }
+};
+
+struct Variance
+{
+  SUBJ_KERNEL_TARGET double operator()(const BinomialValues& x) const
+  {
+    return binomialVariance(x);
+  }
+};
+
+// The fast paths are kept out of line, inlined their restrict qualifications get lost.
+template <typename Operator>
+__attribute__((noinline)) SUBJ_KERNEL_TARGET void
+binomialFusionSeparate(const double* __restrict__ x_b,
+                       const double* __restrict__ x_d,
+                       const double* __restrict__ x_u,
+                       const double* __restrict__ x_a,
+                       const double* __restrict__ y_b,
+                       const double* __restrict__ y_d,
+                       const double* __restrict__ y_u,
+                       const double* __restrict__ y_a,
+                       double* __restrict__ b,
+                       double* __restrict__ d,
+                       double* __restrict__ u,
+                       double* __restrict__ a,
+                       Eigen::Index n)
+{
+  Operator op;
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    BinomialValues fused = op({x_b[i], x_d[i], x_u[i], x_a[i]}, {y_b[i], y_d[i], y_u[i], y_a[i]});
+    b[i]                 = fused.b;
+    d[i]                 = fused.d;
+    u[i]                 = fused.u;
+    a[i]                 = fused.a;
+  }
+}
+
+template <typename Operator>
+SUBJ_KERNEL_TARGET void binomialFusion(const BinomialArraysIn& x,
+                                       const BinomialArraysIn& y,
+                                       const BinomialArraysOut& out,
+                                       Eigen::Index begin,
+                                       Eigen::Index end)
+{
+  if (contiguous(x) && contiguous(y) &&
+      separate(out,
+               {x.b.data, x.d.data, x.u.data, x.a.data, y.b.data, y.d.data, y.u.data, y.a.data},
+               begin,
+               end))
+  {
+    binomialFusionSeparate<Operator>(x.b.data + begin,
+                                     x.d.data + begin,
+                                     x.u.data + begin,
+                                     x.a.data + begin,
+                                     y.b.data + begin,
+                                     y.d.data + begin,
+                                     y.u.data + begin,
+                                     y.a.data + begin,
+                                     out.b.data + begin,
+                                     out.d.data + begin,
+                                     out.u.data + begin,
+                                     out.a.data + begin,
+                                     end - begin);
+    return;
+  }
+
+  Operator op;
+  BinomialBlock x_block, y_block, out_block;
+  for (Eigen::Index block = begin; block < end; block += BLOCK)
+  {
+    Eigen::Index n      = std::min(BLOCK, end - block);
+    BinomialView x_view = view(x, block, n, x_block);
+    BinomialView y_view = view(y, block, n, y_block);
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      storeAt(op(valuesAt(x_view, i), valuesAt(y_view, i)), out_block, i);
+    }
+    scatter(out_block, n, out, block);
+  }
+}
+
+// Kernels with a single output vectorize with the runtime alias checks of the compiler if all
+// arrays are contiguous.
+template <typename Operator>
+SUBJ_KERNEL_TARGET void binomialMeasure(const BinomialArraysIn& x,
+                                        const ArrayOut& out,
+                                        Eigen::Index begin,
+                                        Eigen::Index end)
+{
+  Operator op;
+  if (contiguous(x) && out.stride == 1)
+  {
+    BinomialView x_view = {x.b.data, x.d.data, x.u.data, x.a.data};
+    for (Eigen::Index i = begin; i < end; ++i)
+    {
+      out.data[i] = op(valuesAt(x_view, i));
+    }
+    return;
+  }
+
+  BinomialBlock x_block;
+  double out_block[BLOCK];
+  for (Eigen::Index block = begin; block < end; block += BLOCK)
+  {
+    Eigen::Index n      = std::min(BLOCK, end - block);
+    BinomialView x_view = view(x, block, n, x_block);
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      out_block[i] = op(valuesAt(x_view, i));
+    }
+    scatter(out_block, n, out, block);
+  }
+}
+
+SUBJ_KERNEL_TARGET void binomialAveragingFusionKernel(const BinomialArraysIn& x,
+                                                      const BinomialArraysIn& y,
+                                                      const BinomialArraysOut& out,
+                                                      Eigen::Index begin,
+                                                      Eigen::Index end)
+{
+  binomialFusion<AveragingFusion>(x, y, out, begin, end);
+}
+
+SUBJ_KERNEL_TARGET void binomialCumulativeFusionKernel(const BinomialArraysIn& x,
+                                                       const BinomialArraysIn& y,
+                                                       const BinomialArraysOut& out,
+                                                       Eigen::Index begin,
+                                                       Eigen::Index end)
+{
+  binomialFusion<CumulativeFusion>(x, y, out, begin, end);
+}
+
+__attribute__((noinline)) SUBJ_KERNEL_TARGET void
+binomialTrustDiscountingSeparate(const double* __restrict__ x_b,
+                                 const double* __restrict__ x_d,
+                                 const double* __restrict__ x_u,
+                                 const double* __restrict__ x_a,
+                                 const double* __restrict__ p,
+                                 double* __restrict__ b,
+                                 double* __restrict__ d,
+                                 double* __restrict__ u,
+                                 double* __restrict__ a,
+                                 Eigen::Index n)
+{
+  for (Eigen::Index i = 0; i < n; ++i)
+  {
+    BinomialValues discounted = binomialTrustDiscounting({x_b[i], x_d[i], x_u[i], x_a[i]}, p[i]);
+    b[i]                      = discounted.b;
+    d[i]                      = discounted.d;
+    u[i]                      = discounted.u;
+    a[i]                      = discounted.a;
+  }
+}
+
+SUBJ_KERNEL_TARGET void binomialTrustDiscountingKernel(const BinomialArraysIn& x,
+                                                       const ArrayIn& discount_probability,
+                                                       const BinomialArraysOut& out,
+                                                       Eigen::Index begin,
+                                                       Eigen::Index end)
+{
+  const double* p = discount_probability.data;
+  if (contiguous(x) && discount_probability.stride == 1 &&
+      separate(out, {x.b.data, x.d.data, x.u.data, x.a.data, p}, begin, end))
+  {
+    binomialTrustDiscountingSeparate(x.b.data + begin,
+                                     x.d.data + begin,
+                                     x.u.data + begin,
+                                     x.a.data + begin,
+                                     p + begin,
+                                     out.b.data + begin,
+                                     out.d.data + begin,
+                                     out.u.data + begin,
+                                     out.a.data + begin,
+                                     end - begin);
+    return;
+  }
+
+  BinomialBlock x_block, out_block;
+  double p_block[BLOCK];
+  for (Eigen::Index block = begin; block < end; block += BLOCK)
+  {
+    Eigen::Index n       = std::min(BLOCK, end - block);
+    BinomialView x_view  = view(x, block, n, x_block);
+    const double* p_view = view(discount_probability, block, n, p_block);
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      storeAt(binomialTrustDiscounting(valuesAt(x_view, i), p_view[i]), out_block, i);
+    }
+    scatter(out_block, n, out, block);
+  }
+}
+
+SUBJ_KERNEL_TARGET void binomialProjectionKernel(const BinomialArraysIn& x,
+                                                 const ArrayOut& projection,
+                                                 Eigen::Index begin,
+                                                 Eigen::Index end)
+{
+  binomialMeasure<Projection>(x, projection, begin, end);
+}
+
+SUBJ_KERNEL_TARGET void binomialVarianceKernel(const BinomialArraysIn& x,
+                                               const ArrayOut& variance,
+                                               Eigen::Index begin,
+                                               Eigen::Index end)
+{
+  binomialMeasure<Variance>(x, variance, begin, end);
+}
+
+SUBJ_KERNEL_TARGET void binomialDegreeOfConflictKernel(const BinomialArraysIn& x,
+                                                       const BinomialArraysIn& y,
+                                                       const ArrayOut& conflict,
+                                                       Eigen::Index begin,
+                                                       Eigen::Index end)
+{
+  DegreeOfConflict op;
+  if (contiguous(x) && contiguous(y) && conflict.stride == 1)
+  {
+    BinomialView x_view = {x.b.data, x.d.data, x.u.data, x.a.data};
+    BinomialView y_view = {y.b.data, y.d.data, y.u.data, y.a.data};
+    for (Eigen::Index i = begin; i < end; ++i)
+    {
+      conflict.data[i] = op(valuesAt(x_view, i), valuesAt(y_view, i));
+    }
+    return;
+  }
+
+  BinomialBlock x_block, y_block;
+  double out_block[BLOCK];
+  for (Eigen::Index block = begin; block < end; block += BLOCK)
+  {
+    Eigen::Index n      = std::min(BLOCK, end - block);
+    BinomialView x_view = view(x, block, n, x_block);
+    BinomialView y_view = view(y, block, n, y_block);
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      out_block[i] = op(valuesAt(x_view, i), valuesAt(y_view, i));
+    }
+    scatter(out_block, n, conflict, block);
+  }
+}
+
+SUBJ_KERNEL_TARGET void projectionKernel(const OpinionRows& x,
+                                         double* projection,
+                                         Eigen::Index projection_stride,
+                                         Eigen::Index begin,
+                                         Eigen::Index end)
+{
+  for (Eigen::Index i = begin; i < end; ++i)
+  {
+    const double* belief    = x.belief + i * x.belief_stride;
+    const double* base_rate = x.base_rate + i * x.base_rate_stride;
+    double* out             = projection + i * projection_stride;
+    for (Eigen::Index j = 0; j < x.dim; ++j)
+    {
+      out[j] = belief[j] + base_rate[j] * x.uncertainty[i];
+    }
+  }
+}
+
+SUBJ_KERNEL_TARGET void projectedDistanceKernel(const OpinionRows& x,
+                                                const OpinionRows& y,
+                                                double* distance,
+                                                Eigen::Index begin,
+                                                Eigen::Index end)
+{
+  for (Eigen::Index i = begin; i < end; ++i)
+  {
+    const double* x_belief    = x.belief + i * x.belief_stride;
+    const double* x_base_rate = x.base_rate + i * x.base_rate_stride;
+    const double* y_belief    = y.belief + i * y.belief_stride;
+    const double* y_base_rate = y.base_rate + i * y.base_rate_stride;
+    double sum                = 0.0;
+    for (Eigen::Index j = 0; j < x.dim; ++j)
+    {
+      sum += std::fabs((x_belief[j] + x_base_rate[j] * x.uncertainty[i]) -
+                       (y_belief[j] + y_base_rate[j] * y.uncertainty[i]));
+    }
+    distance[i] = sum / 2.0;
+  }
+}
+
+SUBJ_KERNEL_TARGET void histogramBinsKernel(const double* lower,
+                                            const double* upper,
+                                            Eigen::Index bins,
+                                            const double* values,
+                                            Eigen::Index* index,
+                                            Eigen::Index begin,
+                                            Eigen::Index end)
+{
+  Eigen::Index last = bins - 1;
+  double first      = lower[0];
+  double inner_last = static_cast<double>(last - 1);
+  double scale      = static_cast<double>(bins) / (upper[last] - lower[0]);
+  if (!(scale > 0.0 && scale < HUGE_VAL))
+  {
+    scale = 0.0;
+  }
+
+  double candidate[BLOCK];
+  for (Eigen::Index block = begin; block < end; block += BLOCK)
+  {
+    Eigen::Index n = std::min(BLOCK, end - block);
+    const double* block_values = values + block;
+
+    // Bin of the value if the bins were of equal width, clamped to the inner bins (NaNs included)
+    // and truncated below
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      double bin   = (block_values[i] - first) * scale;
+      bin          = bin < inner_last ? bin : inner_last;
+      candidate[i] = bin >= 1.0 ? bin : 1.0;
+    }
+
+    // Moves the candidate to the bin containing the value, which is exact for any sorted bins
+    for (Eigen::Index i = 0; i < n; ++i)
+    {
+      double value      = block_values[i];
+      Eigen::Index& bin = index[block + i];
+      if (value < upper[0])
+      {
+        bin = 0;
+      }
+      else if (value > lower[last])
+      {
+        bin = last;
+      }
+      else if (last < 2)
+      {
+        bin = 0;
+      }
+      else
+      {
+        Eigen::Index c = static_cast<Eigen::Index>(candidate[i]);
+        while (c > 1 && value < lower[c])
+        {
+          --c;
+        }
+        while (c < last - 1 && value >= upper[c])
+        {
+          ++c;
+        }
+        bin = (value >= lower[c] && value < upper[c]) ? c : 0;
+      }
+    }
+  }
+}
+
+SUBJ_KERNEL_TARGET void dirichletLogDensityKernel(const double* x,
+                                                  Eigen::Index x_stride,
+                                                  Eigen::Index dim,
+                                                  const double* alpha_minus_one,
+                                                  double log_normalization,
+                                                  double* log_density,
+                                                  Eigen::Index begin,
+                                                  Eigen::Index end)
+{
+  for (Eigen::Index i = begin; i < end; ++i)
+  {
+    const double* row = x + i * x_stride;
+    double sum        = log_normalization;
+    for (Eigen::Index j = 0; j < dim; ++j)
+    {
+      // x^0 is 1 even for x = 0, as in DirichletPDF::density()
+      sum += alpha_minus_one[j] == 0.0 ? 0.0 : alpha_minus_one[j] * std::log(row[j]);
+    }
+    log_density[i] = sum;
+  }
+}
+
+} // namespace
+
+const NumericKernels KERNELS = {binomialAveragingFusionKernel,
+                                binomialCumulativeFusionKernel,
+                                binomialTrustDiscountingKernel,
+                                binomialProjectionKernel,
+                                binomialVarianceKernel,
+                                binomialDegreeOfConflictKernel,
+                                projectionKernel,
+                                projectedDistanceKernel,
+                                histogramBinsKernel,
+                                dirichletLogDensityKernel};
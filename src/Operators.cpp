@@ -36,6 +36,14 @@
 
 #include <subj/Operators.h>
 
+#ifndef SUBJ_INLINE_ACCESSORS
+#include <subj/Operators.inl>
+#endif
+
+#include <subj/Expression.h>
+
+#include "FusionKernels.h"
+
 #include <Eigen/Dense>
 #include <limits>
 #include <stdexcept>
@@ -43,47 +51,18 @@
 
 namespace subj {
 
-double projectedDistance(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return (a.projectionMat() - b.projectionMat()).cwiseAbs().sum() / 2.0;
-}
-
-double pd(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return projectedDistance(a, b);
-}
-
-double conjunctiveCertainty(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return (1.0 - a.uncertainty()) * (1.0 - b.uncertainty());
-}
-
-double cc(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return conjunctiveCertainty(a, b);
-}
-
-double degreeOfConflict(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return projectedDistance(a, b) * conjunctiveCertainty(a, b);
-}
-
-double doc(const MultinomialOpinion& a, const MultinomialOpinion& b)
-{
-  return degreeOfConflict(a, b);
-}
+namespace {
 
-MultinomialOpinion averagingBeliefFusion(const std::vector<MultinomialOpinion>& opinions)
+// Checks the preconditions of the N-ary fusion operators and returns the opinions as source of
+// the fusion kernels.
+detail::OpinionSpan fusionSource(const std::vector<MultinomialOpinion>& opinions)
 {
-  // TODO check preconditions, handle special cases
   if (opinions.size() < 2)
   {
     throw std::invalid_argument("At least 2 opinions must be given!");
   }
 
-  size_t size      = opinions.size();
   Eigen::Index dim = opinions[0].dim();
-
   for (const MultinomialOpinion& o : opinions)
   {
     if (o.dim() != dim)
@@ -92,126 +71,96 @@ MultinomialOpinion averagingBeliefFusion(const std::vector<MultinomialOpinion>&
     }
   }
 
-  Eigen::VectorXd u_t(size);
-  double u_a = 1.0;
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> b_mat(dim, size);
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> a_mat(dim, size);
+  return detail::OpinionSpan(opinions.data(), opinions.size());
+}
 
+// True if all opinions share the same base rate handle.
+bool sharedBaseRate(const std::vector<MultinomialOpinion>& opinions)
+{
   for (const MultinomialOpinion& o : opinions)
   {
-    u_a *= o.u();
-  }
-
-  if (!(size <= static_cast<size_t>(std::numeric_limits<Eigen::Index>::max())))
-  {
-    // TODO consider throwing an exception
-    return MultinomialOpinion(2);
+    if (!o.sharesBaseRate(opinions[0]))
+    {
+      return false;
+    }
   }
+  return true;
+}
 
-  for (Eigen::Index i = 0; i < static_cast<Eigen::Index>(size); ++i)
+// Fuses all opinions of the source, which are the given opinions or derived from them keeping
+// their base rates. If all opinions share the same base rate handle, so does the fused opinion and
+// the base rate fusion is skipped.
+template <typename Source>
+MultinomialOpinion fuseOpinions(FusionMode mode,
+                                const Source& source,
+                                const std::vector<MultinomialOpinion>& opinions)
+{
+  Eigen::Index dim = opinions[0].dim();
+  MultinomialOpinion op(static_cast<uint32_t>(dim));
+  if (sharedBaseRate(opinions))
   {
-    u_t[i]       = u_a / opinions[i].u();
-    b_mat.col(i) = opinions[i].bMat();
-    a_mat.col(i) = opinions[i].aMat();
+    op.updateUncertainty(
+      detail::fuseBelief(mode, source, dim, detail::OpinionAccess::belief(op)));
+    op.updateBaseRate(opinions[0].baseRateHandle());
+    return op;
   }
 
-  MultinomialOpinion op(dim);
-  op.b((b_mat.array().rowwise() * u_t.transpose().array()).rowwise().sum() / u_t.sum());
-  op.u(static_cast<double>(size) * u_a);
-  op.a(((a_mat.array().rowwise() * u_t.transpose().array()).rowwise().sum() -
-        (a_mat.array() * u_a).rowwise().sum()) /
-       (u_t.sum() - static_cast<double>(size) * u_a));
+  op.updateUncertainty(detail::fuse(mode,
+                                    source,
+                                    dim,
+                                    detail::OpinionAccess::belief(op),
+                                    detail::OpinionAccess::baseRate(op)));
   return op;
 }
 
-MultinomialOpinion abf(const std::vector<MultinomialOpinion>& opinions)
+} // namespace
+
+MultinomialOpinion averagingBeliefFusion(const std::vector<MultinomialOpinion>& opinions)
+{
+  return fuseOpinions(FusionMode::AVERAGING, fusionSource(opinions), opinions);
+}
+
+MultinomialOpinion averagingBeliefFusion(const MultinomialOpinion& opinion_a,
+                                         const MultinomialOpinion& opinion_b)
 {
-  return averagingBeliefFusion(opinions);
+  return expr::abf(opinion_a, opinion_b);
 }
 
 MultinomialOpinion aleatoryCumulativeBeliefFusion(const std::vector<MultinomialOpinion>& opinions)
 {
-  // TODO check preconditions, handle special cases
   if (opinions.size() < 2)
   {
     throw std::runtime_error("At least 2 opinions must be given!");
   }
 
-  bool all_vacuous = true;
-  for (const MultinomialOpinion& o : opinions)
-  {
-    if (o.u() != 1.0)
-    {
-      all_vacuous = false;
-      break;
-    }
-  }
-  if (all_vacuous)
-  {
-    return opinions[0];
-  }
-
-  size_t size      = opinions.size();
-  Eigen::Index dim = opinions[0].dim();
-
-  for (const MultinomialOpinion& o : opinions)
-  {
-    if (o.dim() != dim)
-    {
-      throw std::runtime_error("All opinions must have the same dimensions!");
-    }
-  }
-
-  Eigen::VectorXd u_t(size);
-  double u_a = 1.0;
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> b_mat(dim, size);
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> a_mat(dim, size);
-
-  for (const MultinomialOpinion& o : opinions)
-  {
-    u_a *= o.u();
-  }
-
-  if (!(size <= static_cast<size_t>(std::numeric_limits<Eigen::Index>::max())))
-  {
-    // TODO consider throwing an exception
-    throw std::runtime_error("Too many opinions given!");
-  }
-
-  for (Eigen::Index i = 0; i < static_cast<Eigen::Index>(size); ++i)
-  {
-    u_t[i]       = u_a / opinions[i].u();
-    b_mat.col(i) = opinions[i].bMat();
-    a_mat.col(i) = opinions[i].aMat();
-  }
-
-  MultinomialOpinion op(dim);
-  op.b((b_mat.array().rowwise() * u_t.transpose().array()).rowwise().sum() /
-       (u_t.sum() - (static_cast<double>(size) - 1) * u_a));
-  op.u(u_a / (u_t.sum() - (static_cast<double>(size) - 1) * u_a));
-  op.a(((a_mat.array().rowwise() * u_t.transpose().array()).rowwise().sum() -
-        (a_mat.array() * u_a).rowwise().sum()) /
-       (u_t.sum() - static_cast<double>(size) * u_a));
-  return op;
+  return fuseOpinions(FusionMode::CUMULATIVE, fusionSource(opinions), opinions);
 }
 
 MultinomialOpinion aleatoryCumulativeBeliefFusion(const MultinomialOpinion& opinion_a,
                                                   const MultinomialOpinion& opinion_b)
 {
-  std::vector<MultinomialOpinion> opinions;
-  opinions.push_back(opinion_a);
-  opinions.push_back(opinion_b);
-  return aleatoryCumulativeBeliefFusion(opinions);
+  return expr::cbf(opinion_a, opinion_b);
+}
+
+MultinomialOpinion weightedBeliefFusion(const MultinomialOpinion& opinion_a,
+                                        const MultinomialOpinion& opinion_b)
+{
+  return expr::wbf(opinion_a, opinion_b);
+}
+
+MultinomialOpinion weightedBeliefFusion(const std::vector<MultinomialOpinion>& opinions)
+{
+  return fuseOpinions(FusionMode::WEIGHTED, fusionSource(opinions), opinions);
 }
 
-MultinomialOpinion cbf(const std::vector<MultinomialOpinion>& opinions)
+MultinomialOpinion consensusAndCompromiseFusion(const std::vector<MultinomialOpinion>& opinions)
 {
-  return aleatoryCumulativeBeliefFusion(opinions);
+  return fuseOpinions(FusionMode::CONSENSUS_AND_COMPROMISE, fusionSource(opinions), opinions);
 }
 
-MultinomialOpinion cbf(const MultinomialOpinion& opinion_a, const MultinomialOpinion& opinion_b)
+MultinomialOpinion beliefConstraintFusion(const std::vector<MultinomialOpinion>& opinions)
 {
-  return aleatoryCumulativeBeliefFusion(opinion_a, opinion_b);
+  return fuseOpinions(FusionMode::BELIEF_CONSTRAINT, fusionSource(opinions), opinions);
 }
 
 MultinomialOpinion cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
@@ -221,8 +170,9 @@ MultinomialOpinion cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
   // TODO handle special cases
 
   MultinomialOpinion res_op(fused_opinion.dim());
-  res_op.b(((fused_opinion.bMat() * opinion.u()) - (opinion.bMat() * fused_opinion.u())) /
-           (opinion.u() - fused_opinion.u() + opinion.u() * fused_opinion.u()));
+  detail::OpinionAccess::belief(res_op) =
+    ((fused_opinion.bMat() * opinion.u()) - (opinion.bMat() * fused_opinion.u())) /
+    (opinion.u() - fused_opinion.u() + opinion.u() * fused_opinion.u());
   res_op.u((opinion.u() * fused_opinion.u()) /
            (opinion.u() - fused_opinion.u() + opinion.u() * fused_opinion.u()));
   res_op.a(base_rate);
@@ -230,105 +180,213 @@ MultinomialOpinion cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
   return res_op;
 }
 
-MultinomialOpinion trustDiscounting(const MultinomialOpinion& opinion,
-                                    const double& discount_probability)
+MultinomialOpinion discountAndFuse(const std::vector<MultinomialOpinion>& opinions,
+                                   const std::vector<double>& discount_probabilities,
+                                   FusionMode mode)
 {
-  MultinomialOpinion op(opinion.dim());
-  op.b(opinion.bMat() * discount_probability);
-  op.u(1 - discount_probability * opinion.bMat().sum());
-  op.a(opinion.aMat());
+  if (opinions.empty())
+  {
+    throw std::invalid_argument("At least 1 opinion must be given!");
+  }
+  if (discount_probabilities.size() != opinions.size())
+  {
+    throw std::invalid_argument("One discount probability per opinion must be given!");
+  }
 
-  return op;
+  Eigen::Index dim = opinions[0].dim();
+  for (const MultinomialOpinion& o : opinions)
+  {
+    if (o.dim() != dim)
+    {
+      throw std::runtime_error("All opinions must have the same dimensions!");
+    }
+  }
+
+  detail::OpinionSpan source(opinions.data(), opinions.size());
+  detail::DiscountedSource<detail::OpinionSpan> discounted(source, discount_probabilities.data());
+  return fuseOpinions(mode, discounted, opinions);
 }
 
-MultinomialOpinion td(const MultinomialOpinion& opinion, const double& discount_probability)
+void averagingBeliefFusion(const MultinomialOpinion& opinion_a,
+                           const MultinomialOpinion& opinion_b,
+                           MultinomialOpinion& result)
 {
-  return trustDiscounting(opinion, discount_probability);
+  expr::evaluate(expr::abf(opinion_a, opinion_b), result);
 }
 
-MultinomialOpinion normalMultiplication(const MultinomialOpinion& opinion1,
-                                        const MultinomialOpinion& opinion2)
+void aleatoryCumulativeBeliefFusion(const MultinomialOpinion& opinion_a,
+                                    const MultinomialOpinion& opinion_b,
+                                    MultinomialOpinion& result)
 {
-  MultinomialOpinion result(opinion1.dim() * opinion2.dim());
-
-  Eigen::Matrix<double, Eigen::Dynamic, 1> b_1 = opinion1.beliefMat();
-  Eigen::Matrix<double, Eigen::Dynamic, 1> b_2 = opinion2.beliefMat();
-  double u_1                                   = opinion1.uncertainty();
-  double u_2                                   = opinion2.uncertainty();
-  Eigen::Matrix<double, Eigen::Dynamic, 1> a_1 = opinion1.baseRateMat();
-  Eigen::Matrix<double, Eigen::Dynamic, 1> a_2 = opinion2.baseRateMat();
-
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> b_single = b_1 * b_2.transpose();
-  // Eigen::Matrix<double, Eigen::Dynamic, 1> b_rows                = b_1 * u_2;
-  // Eigen::Matrix<double, Eigen::Dynamic, 1> b_cols                = u_1 * b_2;
-  // double u_rows                                                  = b_rows.sum();
-  // double u_cols                                                  = b_cols.sum();
-  // double u_dom                                                   = u_1 * u_2;
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> a = a_1 * a_2.transpose();
-
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> p_prod;
-  p_prod = (b_1 + a_1 * u_1) * (b_2 + a_2 * u_2).transpose();
-
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> u_all;
-  //u_all    = (p_prod - b_single).array() / a.array();
-  u_all    = (u_all.array().isNaN()).select(std::numeric_limits<double>::max(), u_all);
-  double u = u_all.minCoeff();
+  expr::evaluate(expr::cbf(opinion_a, opinion_b), result);
+}
 
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> b;
-  b = p_prod - a * u;
+void weightedBeliefFusion(const MultinomialOpinion& opinion_a,
+                          const MultinomialOpinion& opinion_b,
+                          MultinomialOpinion& result)
+{
+  expr::evaluate(expr::wbf(opinion_a, opinion_b), result);
+}
 
-  b.transposeInPlace();
-  Eigen::Matrix<double, Eigen::Dynamic, 1> b_res(
-    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1> >(b.data(), b.cols() * b.rows()));
-  a.transposeInPlace();
-  Eigen::Matrix<double, Eigen::Dynamic, 1> a_res(
-    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1> >(a.data(), a.cols() * a.rows()));
+void cumulativeUnfusion(const MultinomialOpinion& fused_opinion,
+                        const MultinomialOpinion& opinion,
+                        const Eigen::VectorXd& base_rate,
+                        MultinomialOpinion& result)
+{
+  expr::evaluate(expr::cumulativeUnfusion(fused_opinion, opinion, base_rate), result);
+}
 
-  result.update(b_res, u, a_res);
+void trustDiscounting(const MultinomialOpinion& opinion,
+                      const double& discount_probability,
+                      MultinomialOpinion& result)
+{
+  expr::evaluate(expr::td(opinion, discount_probability), result);
+}
 
+MultinomialOpinion normalMultiplication(const MultinomialOpinion& opinion1,
+                                        const MultinomialOpinion& opinion2)
+{
+  MultinomialOpinion result(static_cast<uint32_t>(opinion1.dim() * opinion2.dim()));
+  normalMultiplication(opinion1, opinion2, result);
   return result;
 }
 
 MultinomialOpinion deduction(const MultinomialOpinion& opinion,
                              const std::vector<MultinomialOpinion>& conditionalOpinions)
 {
-  size_t size        = conditionalOpinions.size();
-  Eigen::Index y_dim = conditionalOpinions[0].dim();
-  MultinomialOpinion result(y_dim);
+  MultinomialOpinion result(static_cast<uint32_t>(conditionalOpinions[0].dim()));
+  deduction(opinion, conditionalOpinions, result);
+  return result;
+}
+
+void fuse(FusionMode mode,
+          const std::vector<MultinomialOpinion>& opinions,
+          MultinomialOpinion& result,
+          Workspace& workspace)
+{
+  detail::OpinionSpan source = fusionSource(opinions);
+  Workspace::Scope scope(workspace);
+
+  // Fused into the workspace first, the result may be one of the inputs
+  Eigen::Index dim = opinions[0].dim();
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> belief = workspace.vector(dim);
+  if (sharedBaseRate(opinions))
+  {
+    double uncertainty       = detail::fuseBelief(mode, source, dim, belief);
+    BaseRateHandle base_rate = opinions[0].baseRateHandle();
+    detail::OpinionAccess::resize(result, dim);
+    detail::OpinionAccess::belief(result) = belief;
+    result.updateUncertainty(uncertainty);
+    result.updateBaseRate(base_rate);
+    return;
+  }
+
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> base_rate = workspace.vector(dim);
+  double uncertainty = detail::fuse(mode, source, dim, belief, base_rate);
+  detail::OpinionAccess::resize(result, dim);
+  detail::OpinionAccess::belief(result) = belief;
+  result.updateUncertainty(uncertainty);
+  detail::OpinionAccess::baseRate(result) = base_rate;
+}
+
+void normalMultiplication(const MultinomialOpinion& opinion1,
+                          const MultinomialOpinion& opinion2,
+                          MultinomialOpinion& result,
+                          Workspace& workspace)
+{
+  Workspace::Scope scope(workspace);
+
+  Eigen::Index dim_1         = opinion1.dim();
+  Eigen::Index dim_2         = opinion2.dim();
+  const Eigen::VectorXd& b_1 = opinion1.beliefMat();
+  const Eigen::VectorXd& b_2 = opinion2.beliefMat();
+  double u_1                 = opinion1.uncertainty();
+  double u_2                 = opinion2.uncertainty();
+  const Eigen::VectorXd& a_1 = opinion1.baseRateMat();
+  const Eigen::VectorXd& a_2 = opinion2.baseRateMat();
+
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> b_single = workspace.matrix(dim_1, dim_2);
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> a        = workspace.matrix(dim_1, dim_2);
+  b_single.noalias() = b_1 * b_2.transpose();
+  a.noalias()        = a_1 * a_2.transpose();
+
+  // Projections of both opinions, their outer product is the projection of the product
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> p_1    = workspace.vector(dim_1);
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> p_2    = workspace.vector(dim_2);
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> p_prod = workspace.matrix(dim_1, dim_2);
+  p_1              = b_1 + a_1 * u_1;
+  p_2              = b_2 + a_2 * u_2;
+  p_prod.noalias() = p_1 * p_2.transpose();
+
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> u_all = workspace.matrix(dim_1, dim_2);
+  u_all    = (p_prod - b_single).array() / a.array();
+  u_all    = (u_all.array().isNaN()).select(std::numeric_limits<double>::max(), u_all);
+  double u = u_all.minCoeff();
+
+  // The products are stored row by row, all inputs have been read
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  detail::OpinionAccess::resize(result, dim_1 * dim_2);
+  Eigen::Map<RowMajorMatrix>(detail::OpinionAccess::belief(result).data(), dim_1, dim_2) =
+    p_prod - a * u;
+  result.updateUncertainty(u);
+  Eigen::Map<RowMajorMatrix>(detail::OpinionAccess::baseRate(result).data(), dim_1, dim_2) = a;
+}
+
+void deduction(const MultinomialOpinion& opinion,
+               const std::vector<MultinomialOpinion>& conditionalOpinions,
+               MultinomialOpinion& result,
+               Workspace& workspace)
+{
+  Workspace::Scope scope(workspace);
+
+  size_t size                = conditionalOpinions.size();
+  Eigen::Index y_dim         = conditionalOpinions[0].dim();
+  const Eigen::VectorXd& b_x = detail::OpinionAccess::belief(opinion);
+  const Eigen::VectorXd& a_x = detail::OpinionAccess::baseRate(opinion);
 
   // MBR
-  Eigen::VectorXd a_y     = Eigen::VectorXd::Zero(y_dim);
-  Eigen::VectorXd a_b_sum = Eigen::VectorXd::Zero(y_dim);
-  double a_u_sum          = 0.0;
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> a_y = workspace.vector(y_dim);
+  double a_u_sum                                  = 0.0;
+  a_y.setZero();
 
   for (size_t i = 0; i < size; ++i)
   {
-    double a_xi = opinion.baseRate()[i];
-    a_b_sum += a_xi * conditionalOpinions[i].beliefMat();
+    double a_xi = a_x[i];
+    a_y += a_xi * detail::OpinionAccess::belief(conditionalOpinions[i]);
     a_u_sum += a_xi * conditionalOpinions[i].uncertainty();
   }
 
-  a_y = a_b_sum / (1.0 - a_u_sum);
+  a_y /= (1.0 - a_u_sum);
 
   // Sub-Simplex Apex Uncertainty
-  Eigen::VectorXd u_j     = Eigen::VectorXd::Zero(y_dim);
-  Eigen::VectorXd p_yxhat = Eigen::VectorXd::Zero(y_dim);
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> b_yx(size, y_dim);
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> u_j     = workspace.vector(y_dim);
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> p_yxhat = workspace.vector(y_dim);
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> b_min   = workspace.vector(y_dim);
+  // Projections of the conditional opinions with base rate a_y, one per column
+  Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> p_cond =
+    workspace.matrix(y_dim, static_cast<Eigen::Index>(size));
+  p_yxhat.setZero();
 
   for (size_t i = 0; i < size; ++i)
   {
-    double a_xi               = opinion.baseRate()[i];
-    MultinomialOpinion condOp = conditionalOpinions[i];
-    condOp.updateBaseRate(a_y);
-    p_yxhat += a_xi * condOp.pMat();
+    const Eigen::VectorXd& b_i = detail::OpinionAccess::belief(conditionalOpinions[i]);
+    Eigen::Index col           = static_cast<Eigen::Index>(i);
+    p_cond.col(col)            = b_i + (a_y * conditionalOpinions[i].uncertainty());
+    p_yxhat += a_x[i] * p_cond.col(col);
 
-    b_yx.block(i, 0, 1, y_dim) = conditionalOpinions[i].beliefMat().transpose();
+    if (i == 0)
+    {
+      b_min = b_i;
+    }
+    else
+    {
+      b_min = b_min.cwiseMin(b_i);
+    }
   }
 
-  Eigen::VectorXd b_yx_column_min = b_yx.colwise().minCoeff();
-  for (size_t j = 0; j < static_cast<size_t>(y_dim); ++j)
+  for (Eigen::Index j = 0; j < y_dim; ++j)
   {
-    u_j[j] = (p_yxhat[j] - b_yx_column_min[j]) / a_y[j];
+    u_j[j] = (p_yxhat[j] - b_min[j]) / a_y[j];
   }
 
   double u_yxhat = u_j.minCoeff();
@@ -337,26 +395,26 @@ MultinomialOpinion deduction(const MultinomialOpinion& opinion,
 
   for (size_t i = 0; i < size; ++i)
   {
-    u_yxibxi_sum += conditionalOpinions[i].uncertainty() * opinion.bMat()[i];
+    u_yxibxi_sum += conditionalOpinions[i].uncertainty() * b_x[i];
   }
 
   double u_yx = opinion.uncertainty() * u_yxhat + u_yxibxi_sum;
 
-  Eigen::VectorXd p_yx = Eigen::VectorXd::Zero(y_dim);
-  Eigen::VectorXd p_x  = opinion.pMat();
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> p_yx = workspace.vector(y_dim);
+  Eigen::Map<Eigen::VectorXd, Eigen::Aligned> p_x  = workspace.vector(b_x.size());
+  p_yx.setZero();
+  p_x = b_x + (a_x * opinion.uncertainty());
 
   for (size_t i = 0; i < size; ++i)
   {
-    MultinomialOpinion condOp = conditionalOpinions[i];
-    condOp.updateBaseRate(a_y);
-    p_yx += p_x[i] * condOp.pMat();
+    p_yx += p_x[i] * p_cond.col(static_cast<Eigen::Index>(i));
   }
 
-  Eigen::VectorXd b_res = p_yx - a_y * u_yx;
-
-  result.update(b_res, u_yx, a_y);
-
-  return result;
+  // All inputs have been read, the result may be one of them
+  detail::OpinionAccess::resize(result, y_dim);
+  detail::OpinionAccess::belief(result) = p_yx - a_y * u_yx;
+  result.updateUncertainty(u_yx);
+  detail::OpinionAccess::baseRate(result) = a_y;
 }
 
 } // namespace subj
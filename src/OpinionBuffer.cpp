@@ -0,0 +1,236 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/OpinionBuffer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+uint64_t aligned(uint64_t offset)
+{
+  return (offset + OpinionBuffer::ALIGNMENT - 1) / OpinionBuffer::ALIGNMENT *
+         OpinionBuffer::ALIGNMENT;
+}
+
+// Whether a buffer of count opinions of dimension dim, i.e. the header, (2 * dim + 1) * count
+// doubles, count owner ids and the alignment padding of the four columns, can be addressed.
+// Checked before the offsets are computed, which would otherwise wrap around for crafted headers.
+bool addressable(uint64_t count, uint64_t dim)
+{
+  const uint64_t limit =
+    std::min<uint64_t>(std::numeric_limits<size_t>::max(), std::numeric_limits<uint64_t>::max());
+  const uint64_t bytes = limit - sizeof(OpinionBufferHeader) - 4 * OpinionBuffer::ALIGNMENT;
+  if (dim > bytes / (4 * sizeof(double)))
+  {
+    return false;
+  }
+  return count <= bytes / ((2 * dim + 1) * sizeof(double) + sizeof(OpinionOwner::Id));
+}
+
+} // namespace
+
+const uint32_t OpinionBuffer::VERSION;
+const uint32_t OpinionBuffer::BYTE_ORDER_MARK;
+const size_t OpinionBuffer::ALIGNMENT;
+
+OpinionBuffer::OpinionBuffer()
+  : OpinionBuffer(std::vector<MultinomialOpinion>())
+{
+}
+
+OpinionBuffer::OpinionBuffer(const std::vector<MultinomialOpinion>& opinions)
+{
+  uint64_t count = opinions.size();
+  uint64_t dim   = opinions.empty() ? 0 : static_cast<uint64_t>(opinions[0].dim());
+
+  for (const MultinomialOpinion& o : opinions)
+  {
+    if (static_cast<uint64_t>(o.dim()) != dim)
+    {
+      throw std::invalid_argument("All opinions must have the same dimensions!");
+    }
+  }
+
+  OpinionBufferHeader h = layout(count, dim);
+  m_data.assign(h.size, 0);
+  std::memcpy(m_data.data(), &h, sizeof(h));
+
+  double* belief      = reinterpret_cast<double*>(m_data.data() + h.belief_offset);
+  double* uncertainty = reinterpret_cast<double*>(m_data.data() + h.uncertainty_offset);
+  double* base_rate   = reinterpret_cast<double*>(m_data.data() + h.base_rate_offset);
+  OpinionOwner::Id* owner =
+    reinterpret_cast<OpinionOwner::Id*>(m_data.data() + h.owner_offset);
+
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    Eigen::Map<Eigen::VectorXd>(belief + i * dim, dim)    = opinions[i].beliefMat();
+    uncertainty[i]                                        = opinions[i].uncertainty();
+    Eigen::Map<Eigen::VectorXd>(base_rate + i * dim, dim) = opinions[i].baseRateMat();
+    owner[i]                                              = opinions[i].owner().id();
+  }
+}
+
+OpinionBuffer::OpinionBuffer(const char* data, size_t size)
+  : m_data(data, data + size)
+{
+  header(data, size);
+}
+
+std::vector<MultinomialOpinion> OpinionBuffer::opinions() const
+{
+  return opinionsFromBytes(m_data.data(), m_data.size());
+}
+
+size_t OpinionBuffer::count() const
+{
+  return header(m_data.data(), m_data.size()).count;
+}
+
+Eigen::Index OpinionBuffer::dim() const
+{
+  return static_cast<Eigen::Index>(header(m_data.data(), m_data.size()).dim);
+}
+
+const char* OpinionBuffer::data() const
+{
+  return m_data.data();
+}
+
+size_t OpinionBuffer::size() const
+{
+  return m_data.size();
+}
+
+OpinionBufferHeader OpinionBuffer::header(const char* data, size_t size)
+{
+  OpinionBufferHeader h;
+
+  if (size < sizeof(h))
+  {
+    throw std::invalid_argument("Too few bytes for an opinion buffer!");
+  }
+
+  std::memcpy(&h, data, sizeof(h));
+
+  if (std::memcmp(h.magic, "SUBJ", 4) != 0)
+  {
+    throw std::invalid_argument("Bytes do not hold an opinion buffer!");
+  }
+  if (h.version != VERSION)
+  {
+    throw std::invalid_argument("Unsupported opinion buffer version!");
+  }
+  if (h.byte_order != BYTE_ORDER_MARK)
+  {
+    throw std::invalid_argument("Opinion buffer has a different byte order!");
+  }
+
+  if (!addressable(h.count, h.dim))
+  {
+    throw std::invalid_argument("Opinion buffer is truncated or corrupted!");
+  }
+
+  OpinionBufferHeader expected = layout(h.count, h.dim);
+  if (h.belief_offset != expected.belief_offset ||
+      h.uncertainty_offset != expected.uncertainty_offset ||
+      h.base_rate_offset != expected.base_rate_offset ||
+      h.owner_offset != expected.owner_offset || h.size != expected.size || size < h.size)
+  {
+    throw std::invalid_argument("Opinion buffer is truncated or corrupted!");
+  }
+
+  return h;
+}
+
+OpinionBufferHeader OpinionBuffer::layout(uint64_t count, uint64_t dim)
+{
+  if (!addressable(count, dim))
+  {
+    throw std::invalid_argument("Opinion buffer would exceed the addressable memory!");
+  }
+
+  OpinionBufferHeader h;
+  std::memset(&h, 0, sizeof(h));
+  std::memcpy(h.magic, "SUBJ", 4);
+  h.version            = VERSION;
+  h.byte_order         = BYTE_ORDER_MARK;
+  h.count              = count;
+  h.dim                = dim;
+  h.belief_offset      = aligned(sizeof(h));
+  h.uncertainty_offset = aligned(h.belief_offset + count * dim * sizeof(double));
+  h.base_rate_offset   = aligned(h.uncertainty_offset + count * sizeof(double));
+  h.owner_offset       = aligned(h.base_rate_offset + count * dim * sizeof(double));
+  h.size               = aligned(h.owner_offset + count * sizeof(OpinionOwner::Id));
+  return h;
+}
+
+std::vector<MultinomialOpinion> opinionsFromBytes(const char* data, size_t size)
+{
+  if (reinterpret_cast<uintptr_t>(data) % alignof(double) != 0)
+  {
+    return OpinionBuffer(data, size).opinions();
+  }
+
+  OpinionBufferHeader h = OpinionBuffer::header(data, size);
+  Eigen::Index dim      = static_cast<Eigen::Index>(h.dim);
+
+  const double* belief      = reinterpret_cast<const double*>(data + h.belief_offset);
+  const double* uncertainty = reinterpret_cast<const double*>(data + h.uncertainty_offset);
+  const double* base_rate   = reinterpret_cast<const double*>(data + h.base_rate_offset);
+  const OpinionOwner::Id* owner =
+    reinterpret_cast<const OpinionOwner::Id*>(data + h.owner_offset);
+
+  std::vector<MultinomialOpinion> opinions;
+  opinions.reserve(h.count);
+
+  for (uint64_t i = 0; i < h.count; ++i)
+  {
+    opinions.emplace_back(Eigen::Map<const Eigen::VectorXd>(belief + i * dim, dim),
+                          uncertainty[i],
+                          Eigen::Map<const Eigen::VectorXd>(base_rate + i * dim, dim));
+    opinions.back().updateOwner(OpinionOwner(owner[i]));
+  }
+
+  return opinions;
+}
+
+} // namespace subj
@@ -0,0 +1,262 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#include <subj/OpinionFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace subj {
+
+namespace {
+
+void writePadding(std::ofstream& file, uint64_t offset)
+{
+  static const char zeros[OpinionBuffer::ALIGNMENT] = {};
+  uint64_t position = static_cast<uint64_t>(file.tellp());
+  file.write(zeros, static_cast<std::streamsize>(offset - position));
+}
+
+void writeColumn(std::ofstream& file, const Eigen::Ref<const BatchMatrix>& column)
+{
+  if (column.outerStride() == column.cols())
+  {
+    file.write(reinterpret_cast<const char*>(column.data()),
+               static_cast<std::streamsize>(column.size() * sizeof(double)));
+    return;
+  }
+
+  for (Eigen::Index i = 0; i < column.rows(); ++i)
+  {
+    file.write(reinterpret_cast<const char*>(column.row(i).data()),
+               static_cast<std::streamsize>(column.cols() * sizeof(double)));
+  }
+}
+
+} // namespace
+
+void writeOpinionFile(const std::string& path, const std::vector<MultinomialOpinion>& opinions)
+{
+  OpinionBuffer buffer(opinions);
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!file)
+  {
+    throw std::runtime_error("Could not write opinion file " + path + "!");
+  }
+}
+
+void writeOpinionFile(const std::string& path,
+                      const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate)
+{
+  writeOpinionFile(path,
+                   belief,
+                   uncertainty,
+                   base_rate,
+                   OwnerVector::Constant(belief.rows(), OpinionOwner::ANONYMOUS));
+}
+
+void writeOpinionFile(const std::string& path,
+                      const Eigen::Ref<const BatchMatrix>& belief,
+                      const Eigen::Ref<const BatchVector>& uncertainty,
+                      const Eigen::Ref<const BatchMatrix>& base_rate,
+                      const Eigen::Ref<const OwnerVector>& owners)
+{
+  if (belief.rows() != uncertainty.rows() || belief.rows() != base_rate.rows() ||
+      belief.cols() != base_rate.cols() || belief.rows() != owners.rows())
+  {
+    throw std::invalid_argument("Belief, uncertainty and base rate must describe the same opinions!");
+  }
+
+  OpinionBufferHeader h = OpinionBuffer::layout(belief.rows(), belief.cols());
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+  file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  writePadding(file, h.belief_offset);
+  writeColumn(file, belief);
+  writePadding(file, h.uncertainty_offset);
+  file.write(reinterpret_cast<const char*>(uncertainty.data()),
+             static_cast<std::streamsize>(uncertainty.size() * sizeof(double)));
+  writePadding(file, h.base_rate_offset);
+  writeColumn(file, base_rate);
+  writePadding(file, h.owner_offset);
+  file.write(reinterpret_cast<const char*>(owners.data()),
+             static_cast<std::streamsize>(owners.size() * sizeof(OpinionOwner::Id)));
+  writePadding(file, h.size);
+
+  if (!file)
+  {
+    throw std::runtime_error("Could not write opinion file " + path + "!");
+  }
+}
+
+MappedOpinionFile::MappedOpinionFile(const std::string& path)
+{
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw std::runtime_error("Could not open opinion file " + path + "!");
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    ::close(fd);
+    throw std::runtime_error("Could not read opinion file " + path + "!");
+  }
+
+  m_size    = static_cast<size_t>(st.st_size);
+  void* ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+
+  if (ptr == MAP_FAILED)
+  {
+    throw std::runtime_error("Could not map opinion file " + path + "!");
+  }
+
+  m_data = static_cast<const char*>(ptr);
+
+  try
+  {
+    m_header = OpinionBuffer::header(m_data, m_size);
+  }
+  catch (...)
+  {
+    ::munmap(const_cast<char*>(m_data), m_size);
+    throw;
+  }
+}
+
+MappedOpinionFile::MappedOpinionFile(MappedOpinionFile&& other)
+  : m_data(other.m_data)
+  , m_size(other.m_size)
+  , m_header(other.m_header)
+{
+  other.m_data = nullptr;
+  other.m_size = 0;
+}
+
+MappedOpinionFile::~MappedOpinionFile()
+{
+  if (m_data != nullptr)
+  {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+}
+
+MappedOpinionFile& MappedOpinionFile::operator=(MappedOpinionFile&& other)
+{
+  std::swap(m_data, other.m_data);
+  std::swap(m_size, other.m_size);
+  std::swap(m_header, other.m_header);
+  return *this;
+}
+
+size_t MappedOpinionFile::count() const
+{
+  return m_header.count;
+}
+
+Eigen::Index MappedOpinionFile::dim() const
+{
+  return static_cast<Eigen::Index>(m_header.dim);
+}
+
+MappedOpinionFile::BatchMatrixMap MappedOpinionFile::belief() const
+{
+  return BatchMatrixMap(reinterpret_cast<const double*>(m_data + m_header.belief_offset),
+                        static_cast<Eigen::Index>(m_header.count),
+                        dim());
+}
+
+MappedOpinionFile::BatchVectorMap MappedOpinionFile::uncertainty() const
+{
+  return BatchVectorMap(reinterpret_cast<const double*>(m_data + m_header.uncertainty_offset),
+                        static_cast<Eigen::Index>(m_header.count));
+}
+
+MappedOpinionFile::BatchMatrixMap MappedOpinionFile::baseRate() const
+{
+  return BatchMatrixMap(reinterpret_cast<const double*>(m_data + m_header.base_rate_offset),
+                        static_cast<Eigen::Index>(m_header.count),
+                        dim());
+}
+
+MappedOpinionFile::OwnerVectorMap MappedOpinionFile::owners() const
+{
+  return OwnerVectorMap(reinterpret_cast<const OpinionOwner::Id*>(m_data + m_header.owner_offset),
+                        static_cast<Eigen::Index>(m_header.count));
+}
+
+MultinomialOpinion MappedOpinionFile::opinion(size_t index) const
+{
+  if (index >= count())
+  {
+    throw std::out_of_range("Opinion index out of range!");
+  }
+
+  Eigen::Index i = static_cast<Eigen::Index>(index);
+  MultinomialOpinion result(
+    belief().row(i).transpose(), uncertainty()(i), baseRate().row(i).transpose());
+  result.updateOwner(OpinionOwner(owners()(i)));
+  return result;
+}
+
+std::vector<MultinomialOpinion> MappedOpinionFile::opinions(size_t begin, size_t end) const
+{
+  if (begin > end || end > count())
+  {
+    throw std::out_of_range("Opinion range out of range!");
+  }
+
+  std::vector<MultinomialOpinion> result;
+  result.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i)
+  {
+    result.push_back(opinion(i));
+  }
+  return result;
+}
+
+} // namespace subj
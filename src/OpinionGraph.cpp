@@ -0,0 +1,291 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/OpinionGraph.h>
+
+#include <subj/Operators.h>
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+// Nodes of one level handed to a single thread, evaluating a node is far more work than a
+// single element of a batch
+const size_t GRAPH_GRAIN_SIZE = 16;
+
+} // namespace
+
+OpinionGraph::NodeId OpinionGraph::addInput(const MultinomialOpinion& opinion)
+{
+  Node node = {Operation::INPUT, {}, {}, 1.0, 0, false, opinion};
+  m_nodes.push_back(node);
+  return m_nodes.size() - 1;
+}
+
+OpinionGraph::NodeId OpinionGraph::addCumulativeFusion(const std::vector<NodeId>& inputs)
+{
+  return addNode(Operation::CUMULATIVE_FUSION, inputs);
+}
+
+OpinionGraph::NodeId OpinionGraph::addAveragingFusion(const std::vector<NodeId>& inputs)
+{
+  return addNode(Operation::AVERAGING_FUSION, inputs);
+}
+
+OpinionGraph::NodeId OpinionGraph::addTrustDiscounting(const NodeId& input,
+                                                       const double& discount_probability)
+{
+  return addNode(Operation::TRUST_DISCOUNTING, {input}, discount_probability);
+}
+
+OpinionGraph::NodeId OpinionGraph::addDeduction(const NodeId& opinion,
+                                                const std::vector<NodeId>& conditionals)
+{
+  if (conditionals.empty())
+  {
+    throw std::invalid_argument("Deduction needs at least one conditional opinion");
+  }
+  std::vector<NodeId> inputs(1, opinion);
+  inputs.insert(inputs.end(), conditionals.begin(), conditionals.end());
+  return addNode(Operation::DEDUCTION, inputs);
+}
+
+OpinionGraph::NodeId OpinionGraph::addNormalMultiplication(const NodeId& a, const NodeId& b)
+{
+  return addNode(Operation::NORMAL_MULTIPLICATION, {a, b});
+}
+
+void OpinionGraph::setInput(const NodeId& node, const MultinomialOpinion& opinion)
+{
+  checkNode(node);
+  if (m_nodes[node].operation != Operation::INPUT)
+  {
+    throw std::invalid_argument("Only input nodes can be set");
+  }
+  m_nodes[node].value = opinion;
+  markDependentsDirty(node);
+}
+
+void OpinionGraph::setDiscountProbability(const NodeId& node, const double& discount_probability)
+{
+  checkNode(node);
+  Node& n = m_nodes[node];
+  if (n.operation != Operation::TRUST_DISCOUNTING)
+  {
+    throw std::invalid_argument("The node is not a trust discounting node");
+  }
+  n.discount_probability = discount_probability;
+  if (!n.dirty)
+  {
+    n.dirty = true;
+    m_dirty.push_back(node);
+  }
+  markDependentsDirty(node);
+}
+
+size_t OpinionGraph::update()
+{
+  if (m_dirty.empty())
+  {
+    return 0;
+  }
+
+  // m_dirty is only cleared once all nodes are evaluated, so that a throwing operator leaves the
+  // graph in a state where update() can be retried
+  std::vector<NodeId>& dirty = m_dirty;
+  std::sort(dirty.begin(), dirty.end(), [this](const NodeId& a, const NodeId& b) {
+    return m_nodes[a].level < m_nodes[b].level;
+  });
+
+  // Nodes of the same level never depend on each other
+  size_t begin = 0;
+  while (begin < dirty.size())
+  {
+    size_t level = m_nodes[dirty[begin]].level;
+    size_t end   = begin;
+    while (end < dirty.size() && m_nodes[dirty[end]].level == level)
+    {
+      ++end;
+    }
+
+    detail::parallelFor(
+      end - begin,
+      [&](size_t first, size_t last) {
+        for (size_t i = begin + first; i < begin + last; ++i)
+        {
+          Node& node = m_nodes[dirty[i]];
+          node.value = evaluate(node);
+        }
+      },
+      GRAPH_GRAIN_SIZE);
+
+    begin = end;
+  }
+
+  for (const NodeId& node : dirty)
+  {
+    m_nodes[node].dirty = false;
+  }
+  size_t count = dirty.size();
+  dirty.clear();
+  return count;
+}
+
+const MultinomialOpinion& OpinionGraph::value(const NodeId& node)
+{
+  checkNode(node);
+  update();
+  return m_nodes[node].value;
+}
+
+bool OpinionGraph::dirty(const NodeId& node) const
+{
+  checkNode(node);
+  return m_nodes[node].dirty;
+}
+
+OpinionGraph::Operation OpinionGraph::operation(const NodeId& node) const
+{
+  checkNode(node);
+  return m_nodes[node].operation;
+}
+
+const std::vector<OpinionGraph::NodeId>& OpinionGraph::inputs(const NodeId& node) const
+{
+  checkNode(node);
+  return m_nodes[node].inputs;
+}
+
+size_t OpinionGraph::size() const
+{
+  return m_nodes.size();
+}
+
+OpinionGraph::NodeId OpinionGraph::addNode(const Operation& operation,
+                                           const std::vector<NodeId>& inputs,
+                                           const double& discount_probability)
+{
+  if (inputs.empty())
+  {
+    throw std::invalid_argument("A derived node needs at least one input");
+  }
+
+  // Inputs have to be up to date before the new node is evaluated
+  update();
+
+  size_t level = 0;
+  for (const NodeId& input : inputs)
+  {
+    checkNode(input);
+    level = std::max(level, m_nodes[input].level + 1);
+  }
+
+  NodeId id = m_nodes.size();
+  Node node = {operation, inputs, {}, discount_probability, level, false, MultinomialOpinion(1)};
+  node.value = evaluate(node);
+  m_nodes.push_back(node);
+
+  for (const NodeId& input : inputs)
+  {
+    std::vector<NodeId>& dependents = m_nodes[input].dependents;
+    if (std::find(dependents.begin(), dependents.end(), id) == dependents.end())
+    {
+      dependents.push_back(id);
+    }
+  }
+  return id;
+}
+
+MultinomialOpinion OpinionGraph::evaluate(const Node& node) const
+{
+  std::vector<MultinomialOpinion> values;
+  values.reserve(node.inputs.size());
+  for (const NodeId& input : node.inputs)
+  {
+    values.push_back(m_nodes[input].value);
+  }
+
+  switch (node.operation)
+  {
+    case Operation::CUMULATIVE_FUSION:
+      return aleatoryCumulativeBeliefFusion(values);
+    case Operation::AVERAGING_FUSION:
+      return averagingBeliefFusion(values);
+    case Operation::TRUST_DISCOUNTING:
+      return trustDiscounting(values[0], node.discount_probability);
+    case Operation::DEDUCTION:
+      return deduction(values[0],
+                       std::vector<MultinomialOpinion>(values.begin() + 1, values.end()));
+    case Operation::NORMAL_MULTIPLICATION:
+      return normalMultiplication(values[0], values[1]);
+    default:
+      return node.value;
+  }
+}
+
+void OpinionGraph::markDependentsDirty(const NodeId& node)
+{
+  std::vector<NodeId> stack(m_nodes[node].dependents);
+  while (!stack.empty())
+  {
+    NodeId current = stack.back();
+    stack.pop_back();
+    Node& n = m_nodes[current];
+    if (n.dirty)
+    {
+      continue;
+    }
+    n.dirty = true;
+    m_dirty.push_back(current);
+    stack.insert(stack.end(), n.dependents.begin(), n.dependents.end());
+  }
+}
+
+void OpinionGraph::checkNode(const NodeId& node) const
+{
+  if (node >= m_nodes.size())
+  {
+    throw std::out_of_range("Unknown opinion graph node");
+  }
+}
+
+} // namespace subj
@@ -0,0 +1,234 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/OpinionIndex.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace subj {
+
+OpinionIndex::OpinionIndex(const Eigen::Index& dimensions)
+  : m_dim(dimensions)
+  , m_projection_indexes(static_cast<size_t>(dimensions))
+{
+  if (dimensions < 1)
+  {
+    throw std::invalid_argument("The dimension of an opinion index has to be positive");
+  }
+}
+
+void OpinionIndex::put(const std::string& key, const MultinomialOpinion& opinion)
+{
+  if (opinion.dim() != m_dim)
+  {
+    throw std::invalid_argument("The opinion does not match the dimension of the index");
+  }
+
+  auto it = m_slots.find(key);
+  if (it != m_slots.end())
+  {
+    unindexEntry(it->second);
+    Entry& entry     = m_entries[it->second];
+    entry.opinion    = opinion;
+    entry.projection = opinion.projectionMat();
+    indexEntry(it->second);
+    return;
+  }
+
+  Entry entry = {key, opinion, opinion.projectionMat()};
+  size_t slot;
+  if (m_free_slots.empty())
+  {
+    slot = m_entries.size();
+    m_entries.push_back(entry);
+  }
+  else
+  {
+    slot = m_free_slots.back();
+    m_free_slots.pop_back();
+    m_entries[slot] = entry;
+  }
+  m_slots.emplace(key, slot);
+  indexEntry(slot);
+}
+
+bool OpinionIndex::erase(const std::string& key)
+{
+  auto it = m_slots.find(key);
+  if (it == m_slots.end())
+  {
+    return false;
+  }
+  size_t slot = it->second;
+  unindexEntry(slot);
+  m_entries[slot].key.clear();
+  m_free_slots.push_back(slot);
+  m_slots.erase(it);
+  return true;
+}
+
+const MultinomialOpinion& OpinionIndex::get(const std::string& key) const
+{
+  auto it = m_slots.find(key);
+  if (it == m_slots.end())
+  {
+    throw std::out_of_range("No opinion indexed for key " + key);
+  }
+  return m_entries[it->second].opinion;
+}
+
+bool OpinionIndex::contains(const std::string& key) const
+{
+  return m_slots.count(key) > 0;
+}
+
+size_t OpinionIndex::size() const
+{
+  return m_slots.size();
+}
+
+Eigen::Index OpinionIndex::dim() const
+{
+  return m_dim;
+}
+
+std::vector<std::string> OpinionIndex::topProjection(const Eigen::Index& category, size_t k) const
+{
+  return top(projectionIndex(category), k);
+}
+
+std::vector<std::string> OpinionIndex::bottomProjection(const Eigen::Index& category,
+                                                        size_t k) const
+{
+  return bottom(projectionIndex(category), k);
+}
+
+std::vector<std::string> OpinionIndex::projectionRange(const Eigen::Index& category,
+                                                       const double& low,
+                                                       const double& high) const
+{
+  return range(projectionIndex(category), low, high);
+}
+
+std::vector<std::string> OpinionIndex::topUncertainty(size_t k) const
+{
+  return top(m_uncertainty_index, k);
+}
+
+std::vector<std::string> OpinionIndex::bottomUncertainty(size_t k) const
+{
+  return bottom(m_uncertainty_index, k);
+}
+
+std::vector<std::string> OpinionIndex::uncertaintyRange(const double& low,
+                                                        const double& high) const
+{
+  return range(m_uncertainty_index, low, high);
+}
+
+void OpinionIndex::indexEntry(size_t slot)
+{
+  const Entry& entry = m_entries[slot];
+  for (Eigen::Index i = 0; i < m_dim; ++i)
+  {
+    m_projection_indexes[static_cast<size_t>(i)].emplace(entry.projection(i), slot);
+  }
+  m_uncertainty_index.emplace(entry.opinion.uncertainty(), slot);
+}
+
+void OpinionIndex::unindexEntry(size_t slot)
+{
+  const Entry& entry = m_entries[slot];
+  for (Eigen::Index i = 0; i < m_dim; ++i)
+  {
+    m_projection_indexes[static_cast<size_t>(i)].erase(std::make_pair(entry.projection(i), slot));
+  }
+  m_uncertainty_index.erase(std::make_pair(entry.opinion.uncertainty(), slot));
+}
+
+const OpinionIndex::Index& OpinionIndex::projectionIndex(const Eigen::Index& category) const
+{
+  if (category < 0 || category >= m_dim)
+  {
+    throw std::invalid_argument("The category is out of range");
+  }
+  return m_projection_indexes[static_cast<size_t>(category)];
+}
+
+std::vector<std::string> OpinionIndex::top(const Index& index, size_t k) const
+{
+  std::vector<std::string> keys;
+  keys.reserve(std::min(k, index.size()));
+  for (auto it = index.rbegin(); it != index.rend() && keys.size() < k; ++it)
+  {
+    keys.push_back(m_entries[it->second].key);
+  }
+  return keys;
+}
+
+std::vector<std::string> OpinionIndex::bottom(const Index& index, size_t k) const
+{
+  std::vector<std::string> keys;
+  keys.reserve(std::min(k, index.size()));
+  for (auto it = index.begin(); it != index.end() && keys.size() < k; ++it)
+  {
+    keys.push_back(m_entries[it->second].key);
+  }
+  return keys;
+}
+
+std::vector<std::string> OpinionIndex::range(const Index& index,
+                                             const double& low,
+                                             const double& high) const
+{
+  std::vector<std::string> keys;
+  if (!(low <= high))
+  {
+    return keys;
+  }
+  auto it  = index.lower_bound(std::make_pair(low, size_t(0)));
+  auto end = index.upper_bound(std::make_pair(high, std::numeric_limits<size_t>::max()));
+  for (; it != end; ++it)
+  {
+    keys.push_back(m_entries[it->second].key);
+  }
+  return keys;
+}
+
+} // namespace subj
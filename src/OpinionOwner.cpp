@@ -38,6 +38,39 @@
 
 namespace subj {
 
-OpinionOwner::OpinionOwner() = default;
+static_assert(sizeof(OpinionOwner) == sizeof(OpinionOwner::Id),
+              "An opinion owner must not take more space than its id");
+
+const OpinionOwner::Id OpinionOwner::ANONYMOUS;
+
+OpinionOwner::OpinionOwner()
+  : m_id(ANONYMOUS)
+{
+}
+
+OpinionOwner::OpinionOwner(const Id& id)
+  : m_id(id)
+{
+}
+
+OpinionOwner::Id OpinionOwner::id() const
+{
+  return m_id;
+}
+
+bool OpinionOwner::anonymous() const
+{
+  return m_id == ANONYMOUS;
+}
+
+bool OpinionOwner::operator==(const OpinionOwner& other) const
+{
+  return m_id == other.m_id;
+}
+
+bool OpinionOwner::operator!=(const OpinionOwner& other) const
+{
+  return m_id != other.m_id;
+}
 
 } // namespace subj
\ No newline at end of file
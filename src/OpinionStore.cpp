@@ -0,0 +1,191 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/OpinionStore.h>
+
+#include <subj/Operators.h>
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace subj {
+
+const size_t OpinionStore::DEFAULT_SHARD_COUNT;
+
+OpinionStore::OpinionStore(size_t shard_count)
+  : m_shard_count(1)
+  , m_shard_shift(64)
+{
+  while (m_shard_count < shard_count)
+  {
+    m_shard_count <<= 1;
+    --m_shard_shift;
+  }
+  m_shards.reset(new Shard[m_shard_count]);
+}
+
+void OpinionStore::put(const std::string& key, const MultinomialOpinion& opinion)
+{
+  Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.opinions.find(key);
+  if (it == s.opinions.end())
+  {
+    s.opinions.emplace(key, opinion);
+  }
+  else
+  {
+    it->second = opinion;
+  }
+}
+
+MultinomialOpinion OpinionStore::fuseIn(const std::string& key, const MultinomialOpinion& opinion)
+{
+  Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.opinions.find(key);
+  if (it == s.opinions.end())
+  {
+    s.opinions.emplace(key, opinion);
+    return opinion;
+  }
+  it->second = cbf(it->second, opinion);
+  return it->second;
+}
+
+bool OpinionStore::discount(const std::string& key, const double& discount_probability)
+{
+  Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.opinions.find(key);
+  if (it == s.opinions.end())
+  {
+    return false;
+  }
+  it->second = td(it->second, discount_probability);
+  return true;
+}
+
+MultinomialOpinion OpinionStore::get(const std::string& key) const
+{
+  const Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.opinions.find(key);
+  if (it == s.opinions.end())
+  {
+    throw std::out_of_range("No opinion stored for key " + key);
+  }
+  return it->second;
+}
+
+bool OpinionStore::get(const std::string& key, MultinomialOpinion& opinion) const
+{
+  const Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.opinions.find(key);
+  if (it == s.opinions.end())
+  {
+    return false;
+  }
+  opinion = it->second;
+  return true;
+}
+
+bool OpinionStore::contains(const std::string& key) const
+{
+  const Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.opinions.count(key) > 0;
+}
+
+bool OpinionStore::erase(const std::string& key)
+{
+  Shard& s = shard(key);
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.opinions.erase(key) > 0;
+}
+
+size_t OpinionStore::size() const
+{
+  size_t size = 0;
+  for (size_t i = 0; i < m_shard_count; ++i)
+  {
+    std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+    size += m_shards[i].opinions.size();
+  }
+  return size;
+}
+
+size_t OpinionStore::shardCount() const
+{
+  return m_shard_count;
+}
+
+std::vector<std::string> OpinionStore::keys() const
+{
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < m_shard_count; ++i)
+  {
+    std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+    for (const auto& entry : m_shards[i].opinions)
+    {
+      keys.push_back(entry.first);
+    }
+  }
+  return keys;
+}
+
+OpinionStore::Shard& OpinionStore::shard(const std::string& key)
+{
+  const OpinionStore& store = *this;
+  return const_cast<Shard&>(store.shard(key));
+}
+
+const OpinionStore::Shard& OpinionStore::shard(const std::string& key) const
+{
+  if (m_shard_count == 1)
+  {
+    return m_shards[0];
+  }
+  // The unordered_map buckets use the low bits of the same hash, so the shard is taken from the
+  // high bits of a multiplicative mix
+  uint64_t hash = static_cast<uint64_t>(std::hash<std::string>()(key)) * 0x9E3779B97F4A7C15ull;
+  return m_shards[static_cast<size_t>(hash >> m_shard_shift)];
+}
+
+} // namespace subj
@@ -0,0 +1,172 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/OwnerRegistry.h>
+
+#include <subj/Operators.h>
+
+#include "Parallel.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace subj {
+
+OwnerRegistry::OwnerRegistry()
+  : m_names(1)
+{
+}
+
+OpinionOwner OwnerRegistry::intern(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_ids.find(name);
+  if (it != m_ids.end())
+  {
+    return OpinionOwner(it->second);
+  }
+  if (m_names.size() > std::numeric_limits<OpinionOwner::Id>::max())
+  {
+    throw std::length_error("The owner registry cannot hold more owners");
+  }
+  OpinionOwner::Id id = static_cast<OpinionOwner::Id>(m_names.size());
+  m_names.push_back(name);
+  m_ids.emplace(name, id);
+  return OpinionOwner(id);
+}
+
+bool OwnerRegistry::find(const std::string& name, OpinionOwner& owner) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_ids.find(name);
+  if (it == m_ids.end())
+  {
+    return false;
+  }
+  owner = OpinionOwner(it->second);
+  return true;
+}
+
+std::string OwnerRegistry::name(const OpinionOwner& owner) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (owner.id() >= m_names.size())
+  {
+    throw std::out_of_range("Unknown opinion owner");
+  }
+  return m_names[owner.id()];
+}
+
+size_t OwnerRegistry::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_names.size();
+}
+
+OwnerTrust::OwnerTrust(const double& default_probability)
+  : m_default(default_probability)
+{
+}
+
+void OwnerTrust::setTrust(const OpinionOwner& owner, const double& discount_probability)
+{
+  Eigen::Index index = static_cast<Eigen::Index>(owner.id());
+  if (index >= m_trust.rows())
+  {
+    Eigen::Index rows = m_trust.rows();
+    m_trust.conservativeResize(index + 1);
+    m_trust.tail(index + 1 - rows).setConstant(m_default);
+  }
+  m_trust(index) = discount_probability;
+}
+
+double OwnerTrust::trust(const OpinionOwner& owner) const
+{
+  Eigen::Index index = static_cast<Eigen::Index>(owner.id());
+  return (index < m_trust.rows()) ? m_trust(index) : m_default;
+}
+
+double OwnerTrust::defaultTrust() const
+{
+  return m_default;
+}
+
+const BatchVector& OwnerTrust::trustTable() const
+{
+  return m_trust;
+}
+
+std::vector<MultinomialOpinion> ownerTrustDiscounting(
+  const std::vector<MultinomialOpinion>& opinions, const OwnerTrust& trust)
+{
+  std::vector<MultinomialOpinion> result(opinions.size(), MultinomialOpinion(1));
+  detail::parallelFor(opinions.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      result[i] = trustDiscounting(opinions[i], trust.trust(opinions[i].owner()));
+      result[i].updateOwner(opinions[i].owner());
+    }
+  });
+  return result;
+}
+
+OpinionBatch batchOwnerTrustDiscounting(const Eigen::Ref<const BatchMatrix>& belief,
+                                        const Eigen::Ref<const BatchVector>& uncertainty,
+                                        const Eigen::Ref<const BatchMatrix>& base_rate,
+                                        const Eigen::Ref<const OwnerVector>& owners,
+                                        const OwnerTrust& trust)
+{
+  if (owners.rows() != belief.rows())
+  {
+    throw std::invalid_argument("One owner per opinion must be given!");
+  }
+
+  // Gather the per-row probabilities, the discounting itself is the batched operator
+  const BatchVector& table = trust.trustTable();
+  BatchVector probability(owners.rows());
+  detail::parallelFor(static_cast<size_t>(owners.rows()), [&](size_t begin, size_t end) {
+    for (Eigen::Index i = begin; i < static_cast<Eigen::Index>(end); ++i)
+    {
+      Eigen::Index id = static_cast<Eigen::Index>(owners(i));
+      probability(i)  = (id < table.rows()) ? table(id) : trust.defaultTrust();
+    }
+  });
+
+  return batchTrustDiscounting(belief, uncertainty, base_rate, probability);
+}
+
+} // namespace subj
@@ -0,0 +1,118 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+#ifndef SUBJ_PARALLEL_H_INCLUDED
+#define SUBJ_PARALLEL_H_INCLUDED
+
+#include <subj/Executor.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace subj {
+namespace detail {
+
+// Minimum amount of work items handed to a single task.
+const size_t PARALLEL_GRAIN_SIZE = 256;
+
+// Tasks per thread of the executor, more than one lets idle threads balance uneven ranges.
+const size_t PARALLEL_TASKS_PER_THREAD = 4;
+
+// Executor and number of tasks a call over count items is split into, respecting the grain, the
+// concurrency of the executor and the ParallelScope of the calling thread. Without an executor
+// the call runs serially.
+struct ParallelPlan
+{
+  std::shared_ptr<Executor> executor;
+  size_t tasks;
+};
+
+ParallelPlan parallelPlan(size_t count, size_t grain);
+
+// Calls function(begin, end) on disjoint, contiguous ranges covering [0, count). The ranges run
+// as tasks of the shared executor, or as a single range in the calling thread if the call is too
+// small, the executor has a concurrency of 1 or the ParallelScope of the thread asks for it.
+// Exceptions thrown in any range are rethrown in the calling thread, those of the first range
+// taking precedence.
+template <typename Function>
+void parallelFor(size_t count, const Function& function, size_t grain = PARALLEL_GRAIN_SIZE)
+{
+  if (count == 0)
+  {
+    return;
+  }
+
+  ParallelPlan plan = parallelPlan(count, grain);
+  if (plan.tasks <= 1)
+  {
+    function(size_t(0), count);
+    return;
+  }
+
+  size_t chunk = (count + plan.tasks - 1) / plan.tasks;
+  size_t tasks = (count + chunk - 1) / chunk;
+  size_t limit = ParallelScope::maxTasks();
+  std::vector<std::exception_ptr> errors(tasks);
+
+  plan.executor->run(tasks, [&](size_t t) {
+    // Operators called from the task see the parallelism hint of the caller
+    ParallelScope scope(limit);
+    try
+    {
+      function(t * chunk, std::min(count, (t + 1) * chunk));
+    }
+    catch (...)
+    {
+      errors[t] = std::current_exception();
+    }
+  });
+
+  for (const std::exception_ptr& error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace detail
+} // namespace subj
+
+#endif /* SUBJ_PARALLEL_H_INCLUDED */
@@ -0,0 +1,711 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/SparseOpinion.h>
+
+#include <subj/FusionMode.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace subj {
+
+namespace detail {
+
+struct SparseOpinionAccess
+{
+  static SparseOpinion make(std::vector<SparseEntry>&& belief,
+                            const double& uncertainty,
+                            const SparseBaseRatePtr& base_rate)
+  {
+    return SparseOpinion(std::move(belief), uncertainty, base_rate);
+  }
+};
+
+} // namespace detail
+
+namespace {
+
+bool categoryLess(const SparseEntry& a, const SparseEntry& b)
+{
+  return a.first < b.first;
+}
+
+void checkCategory(const Eigen::Index& dimensions, const Eigen::Index& category)
+{
+  if (category < 0 || category >= dimensions)
+  {
+    throw std::out_of_range("Category outside of the domain!");
+  }
+}
+
+// Orders the entries by category and checks that every category is given at most once.
+std::vector<SparseEntry> sortedEntries(const Eigen::Index& dimensions,
+                                       std::vector<SparseEntry> entries)
+{
+  std::sort(entries.begin(), entries.end(), categoryLess);
+  for (size_t i = 0; i < entries.size(); ++i)
+  {
+    checkCategory(dimensions, entries[i].first);
+    if (i > 0 && entries[i].first == entries[i - 1].first)
+    {
+      throw std::invalid_argument("Categories must not be given more than once!");
+    }
+  }
+  return entries;
+}
+
+// Value of the category in the entries ordered by category, or the fallback if it has none.
+double lookup(const std::vector<SparseEntry>& entries,
+              const Eigen::Index& category,
+              const double& fallback)
+{
+  std::vector<SparseEntry>::const_iterator it = std::lower_bound(
+    entries.begin(), entries.end(), SparseEntry(category, 0.0), categoryLess);
+  return (it != entries.end() && it->first == category) ? it->second : fallback;
+}
+
+// Per opinion weights of the beliefs and base rates in a fusion, and the fused uncertainty. The
+// weights follow the fusion kernels of multinomial opinions.
+struct FusionWeights
+{
+  std::vector<double> belief;
+  std::vector<double> base_rate;
+  double uncertainty;
+};
+
+FusionWeights fusionWeights(FusionMode mode, const std::vector<const SparseOpinion*>& opinions)
+{
+  size_t size = opinions.size();
+  FusionWeights weights{
+    std::vector<double>(size, 0.0), std::vector<double>(size, 1.0 / size), 1.0};
+
+  size_t dogmatic       = 0;
+  double inverse_sum    = 0.0;
+  double confidence_sum = 0.0;
+  double weight_sum     = 0.0;
+  for (const SparseOpinion* o : opinions)
+  {
+    double u = o->u();
+    if (u == 0.0)
+    {
+      ++dogmatic;
+    }
+    else
+    {
+      inverse_sum += 1.0 / u;
+      weight_sum += (1.0 - u) / u;
+    }
+    confidence_sum += 1.0 - u;
+  }
+
+  // Fusing only vacuous opinions, the base rate is averaged.
+  if (confidence_sum == 0.0)
+  {
+    return weights;
+  }
+
+  if (mode == FusionMode::WEIGHTED)
+  {
+    for (size_t k = 0; k < size; ++k)
+    {
+      weights.base_rate[k] = (1.0 - opinions[k]->u()) / confidence_sum;
+    }
+  }
+
+  // Dogmatic opinions dominate, their beliefs and base rates are averaged.
+  if (dogmatic > 0)
+  {
+    for (size_t k = 0; k < size; ++k)
+    {
+      weights.belief[k] = opinions[k]->u() == 0.0 ? 1.0 / static_cast<double>(dogmatic) : 0.0;
+      if (mode != FusionMode::WEIGHTED)
+      {
+        weights.base_rate[k] = weights.belief[k];
+      }
+    }
+    weights.uncertainty = 0.0;
+    return weights;
+  }
+
+  double n = static_cast<double>(size);
+  switch (mode)
+  {
+    case FusionMode::CUMULATIVE:
+    case FusionMode::AVERAGING:
+    {
+      bool cumulative = (mode == FusionMode::CUMULATIVE);
+      double norm     = cumulative ? inverse_sum - (n - 1.0) : inverse_sum;
+      for (size_t k = 0; k < size; ++k)
+      {
+        double inverse       = 1.0 / opinions[k]->u();
+        weights.belief[k]    = inverse / norm;
+        weights.base_rate[k] = (inverse - 1.0) / (inverse_sum - n);
+      }
+      weights.uncertainty = cumulative ? 1.0 / norm : n / norm;
+      break;
+    }
+    case FusionMode::WEIGHTED:
+      for (size_t k = 0; k < size; ++k)
+      {
+        double u          = opinions[k]->u();
+        weights.belief[k] = (1.0 - u) / u / weight_sum;
+      }
+      weights.uncertainty = confidence_sum / weight_sum;
+      break;
+    default:
+      throw std::invalid_argument("Fusion mode not supported for sparse opinions!");
+  }
+  return weights;
+}
+
+SparseBaseRatePtr fusedBaseRate(const std::vector<const SparseOpinion*>& opinions,
+                                const std::vector<double>& weights)
+{
+  // Opinions sharing the same base rate keep sharing it.
+  SparseBaseRatePtr shared;
+  bool all_shared = true;
+  for (size_t k = 0; k < opinions.size() && all_shared; ++k)
+  {
+    if (weights[k] == 0.0)
+    {
+      continue;
+    }
+    if (!shared)
+    {
+      shared = opinions[k]->sharedBaseRate();
+    }
+    all_shared = (opinions[k]->sharedBaseRate() == shared);
+  }
+  if (all_shared)
+  {
+    return shared;
+  }
+
+  std::vector<Eigen::Index> categories;
+  for (size_t k = 0; k < opinions.size(); ++k)
+  {
+    if (weights[k] != 0.0)
+    {
+      for (const SparseEntry& e : opinions[k]->sharedBaseRate()->exceptions())
+      {
+        categories.push_back(e.first);
+      }
+    }
+  }
+  std::sort(categories.begin(), categories.end());
+  categories.erase(std::unique(categories.begin(), categories.end()), categories.end());
+
+  std::vector<SparseEntry> exceptions;
+  exceptions.reserve(categories.size());
+  for (Eigen::Index category : categories)
+  {
+    double value = 0.0;
+    for (size_t k = 0; k < opinions.size(); ++k)
+    {
+      if (weights[k] != 0.0)
+      {
+        value += weights[k] * opinions[k]->baseRate(category);
+      }
+    }
+    exceptions.push_back(SparseEntry(category, value));
+  }
+  return std::make_shared<SparseBaseRate>(opinions[0]->dim(), exceptions);
+}
+
+SparseOpinion fuse(FusionMode mode, const std::vector<const SparseOpinion*>& opinions)
+{
+  if (opinions.size() < 2)
+  {
+    throw std::invalid_argument("At least 2 opinions must be given!");
+  }
+
+  Eigen::Index dim = opinions[0]->dim();
+  bool all_vacuous = true;
+  for (const SparseOpinion* o : opinions)
+  {
+    if (o->dim() != dim)
+    {
+      throw std::runtime_error("All opinions must have the same dimensions!");
+    }
+    all_vacuous = all_vacuous && (o->u() == 1.0);
+  }
+
+  // aleatoryCumulativeBeliefFusion() of vacuous opinions returns the first one
+  if (mode == FusionMode::CUMULATIVE && all_vacuous)
+  {
+    return *opinions[0];
+  }
+
+  FusionWeights weights = fusionWeights(mode, opinions);
+
+  // The beliefs of each opinion are ordered, so merging them in keeps the result ordered.
+  std::vector<SparseEntry> belief;
+  for (size_t k = 0; k < opinions.size(); ++k)
+  {
+    if (weights.belief[k] == 0.0)
+    {
+      continue;
+    }
+    size_t middle = belief.size();
+    for (const SparseEntry& e : opinions[k]->entries())
+    {
+      belief.push_back(SparseEntry(e.first, weights.belief[k] * e.second));
+    }
+    std::inplace_merge(belief.begin(), belief.begin() + middle, belief.end(), categoryLess);
+  }
+
+  size_t out = 0;
+  for (size_t i = 0; i < belief.size(); ++i)
+  {
+    if (out > 0 && belief[out - 1].first == belief[i].first)
+    {
+      belief[out - 1].second += belief[i].second;
+    }
+    else
+    {
+      belief[out++] = belief[i];
+    }
+  }
+  belief.resize(out);
+
+  return detail::SparseOpinionAccess::make(
+    std::move(belief), weights.uncertainty, fusedBaseRate(opinions, weights.base_rate));
+}
+
+std::vector<const SparseOpinion*> pointers(const std::vector<SparseOpinion>& opinions)
+{
+  std::vector<const SparseOpinion*> result;
+  result.reserve(opinions.size());
+  for (const SparseOpinion& o : opinions)
+  {
+    result.push_back(&o);
+  }
+  return result;
+}
+
+} // namespace
+
+SparseBaseRate::SparseBaseRate(const Eigen::Index& dimensions)
+  : SparseBaseRate(dimensions, std::vector<SparseEntry>())
+{
+}
+
+SparseBaseRate::SparseBaseRate(const Eigen::Index& dimensions,
+                               const std::vector<SparseEntry>& exceptions)
+  : m_dim(dimensions)
+  , m_default(0.0)
+  , m_exceptions(sortedEntries(dimensions, exceptions))
+{
+  if (dimensions < 1)
+  {
+    throw std::invalid_argument("The dimension must be positive!");
+  }
+
+  double sum = 0.0;
+  for (const SparseEntry& e : m_exceptions)
+  {
+    sum += e.second;
+  }
+  if (sum > 1.0 + 1e-9)
+  {
+    throw std::invalid_argument("The base rate exceptions must not sum up to more than 1!");
+  }
+
+  Eigen::Index remaining = dimensions - static_cast<Eigen::Index>(m_exceptions.size());
+  if (remaining > 0)
+  {
+    m_default = std::max(0.0, 1.0 - sum) / static_cast<double>(remaining);
+  }
+}
+
+double SparseBaseRate::at(const Eigen::Index& category) const
+{
+  checkCategory(m_dim, category);
+  return lookup(m_exceptions, category, m_default);
+}
+
+double SparseBaseRate::defaultValue() const
+{
+  return m_default;
+}
+
+const std::vector<SparseEntry>& SparseBaseRate::exceptions() const
+{
+  return m_exceptions;
+}
+
+Eigen::Index SparseBaseRate::dim() const
+{
+  return m_dim;
+}
+
+SparseOpinion::SparseOpinion(const Eigen::Index& dimensions)
+  : m_uncertainty(1.0)
+  , m_base_rate(std::make_shared<SparseBaseRate>(dimensions))
+{
+}
+
+SparseOpinion::SparseOpinion(const Eigen::Index& dimensions,
+                             const std::vector<SparseEntry>& belief,
+                             const double& uncertainty,
+                             const SparseBaseRatePtr& base_rate)
+  : m_belief(sortedEntries(dimensions, belief))
+  , m_uncertainty(uncertainty)
+  , m_base_rate(base_rate ? base_rate : std::make_shared<SparseBaseRate>(dimensions))
+{
+  if (m_base_rate->dim() != dimensions)
+  {
+    throw std::invalid_argument("The base rate must have the dimension of the opinion!");
+  }
+  m_belief.erase(std::remove_if(m_belief.begin(),
+                                m_belief.end(),
+                                [](const SparseEntry& e) { return e.second == 0.0; }),
+                 m_belief.end());
+  setUncertainty(uncertainty);
+}
+
+SparseOpinion::SparseOpinion(const MultinomialOpinion& opinion)
+  : m_uncertainty(opinion.u())
+{
+  const MultinomialOpinion::Vector& belief    = detail::OpinionAccess::belief(opinion);
+  const MultinomialOpinion::Vector& base_rate = detail::OpinionAccess::baseRate(opinion);
+
+  for (Eigen::Index i = 0; i < opinion.dim(); ++i)
+  {
+    if (belief(i) != 0.0)
+    {
+      m_belief.push_back(SparseEntry(i, belief(i)));
+    }
+  }
+
+  // The most frequent base rate becomes the default.
+  std::vector<double> values(base_rate.data(), base_rate.data() + base_rate.size());
+  std::sort(values.begin(), values.end());
+  double most_frequent = values.empty() ? 0.0 : values[0];
+  size_t longest       = 0;
+  for (size_t begin = 0, end = 0; begin < values.size(); begin = end)
+  {
+    while (end < values.size() && values[end] == values[begin])
+    {
+      ++end;
+    }
+    if (end - begin > longest)
+    {
+      longest       = end - begin;
+      most_frequent = values[begin];
+    }
+  }
+
+  std::vector<SparseEntry> exceptions;
+  for (Eigen::Index i = 0; i < opinion.dim(); ++i)
+  {
+    if (base_rate(i) != most_frequent)
+    {
+      exceptions.push_back(SparseEntry(i, base_rate(i)));
+    }
+  }
+  m_base_rate = std::make_shared<SparseBaseRate>(opinion.dim(), exceptions);
+  setUncertainty(opinion.u());
+}
+
+SparseOpinion::SparseOpinion(std::vector<SparseEntry>&& belief,
+                             const double& uncertainty,
+                             const SparseBaseRatePtr& base_rate)
+  : m_belief(std::move(belief))
+  , m_uncertainty(uncertainty)
+  , m_base_rate(base_rate)
+{
+  m_belief.erase(std::remove_if(m_belief.begin(),
+                                m_belief.end(),
+                                [](const SparseEntry& e) { return e.second == 0.0; }),
+                 m_belief.end());
+  setUncertainty(uncertainty);
+}
+
+void SparseOpinion::setUncertainty(const double& uncertainty)
+{
+  double sum = 0.0;
+  for (const SparseEntry& e : m_belief)
+  {
+    sum += e.second;
+  }
+  m_uncertainty = (sum + uncertainty == 1) ? uncertainty : 1 - sum;
+}
+
+MultinomialOpinion SparseOpinion::dense() const
+{
+  if (dim() > static_cast<Eigen::Index>(std::numeric_limits<uint32_t>::max()))
+  {
+    throw std::length_error("The opinion is too large to be dense!");
+  }
+
+  MultinomialOpinion opinion(static_cast<uint32_t>(dim()));
+  MultinomialOpinion::Vector& belief    = detail::OpinionAccess::belief(opinion);
+  MultinomialOpinion::Vector& base_rate = detail::OpinionAccess::baseRate(opinion);
+
+  base_rate.setConstant(m_base_rate->defaultValue());
+  for (const SparseEntry& e : m_base_rate->exceptions())
+  {
+    base_rate(e.first) = e.second;
+  }
+  for (const SparseEntry& e : m_belief)
+  {
+    belief(e.first) = e.second;
+  }
+  opinion.updateUncertainty(m_uncertainty);
+  return opinion;
+}
+
+const std::vector<SparseEntry>& SparseOpinion::entries() const
+{
+  return m_belief;
+}
+
+double SparseOpinion::belief(const Eigen::Index& category) const
+{
+  checkCategory(dim(), category);
+  return lookup(m_belief, category, 0.0);
+}
+
+double SparseOpinion::uncertainty() const
+{
+  return m_uncertainty;
+}
+
+double SparseOpinion::u() const
+{
+  return uncertainty();
+}
+
+double SparseOpinion::baseRate(const Eigen::Index& category) const
+{
+  return m_base_rate->at(category);
+}
+
+const SparseBaseRatePtr& SparseOpinion::sharedBaseRate() const
+{
+  return m_base_rate;
+}
+
+double SparseOpinion::projection(const Eigen::Index& category) const
+{
+  return belief(category) + baseRate(category) * m_uncertainty;
+}
+
+SparseEntry SparseOpinion::mostProbable() const
+{
+  const std::vector<SparseEntry>& exceptions = m_base_rate->exceptions();
+
+  SparseEntry best(-1, -1.0);
+  Eigen::Index free_category = 0;
+  std::vector<SparseEntry>::const_iterator b = m_belief.begin();
+  std::vector<SparseEntry>::const_iterator a = exceptions.begin();
+
+  // Walks the categories with belief or base rate exception in order, the first category with
+  // neither has the default base rate and no belief.
+  while (b != m_belief.end() || a != exceptions.end())
+  {
+    Eigen::Index category = (a == exceptions.end() || (b != m_belief.end() && b->first < a->first))
+                              ? b->first
+                              : a->first;
+    double belief    = 0.0;
+    double base_rate = m_base_rate->defaultValue();
+    if (b != m_belief.end() && b->first == category)
+    {
+      belief = (b++)->second;
+    }
+    if (a != exceptions.end() && a->first == category)
+    {
+      base_rate = (a++)->second;
+    }
+
+    double projection = belief + base_rate * m_uncertainty;
+    if (projection > best.second)
+    {
+      best = SparseEntry(category, projection);
+    }
+    if (category == free_category)
+    {
+      ++free_category;
+    }
+  }
+
+  if (free_category < dim() && m_base_rate->defaultValue() * m_uncertainty > best.second)
+  {
+    best = SparseEntry(free_category, m_base_rate->defaultValue() * m_uncertainty);
+  }
+  return best;
+}
+
+Eigen::Index SparseOpinion::dim() const
+{
+  return m_base_rate->dim();
+}
+
+size_t SparseOpinion::nnz() const
+{
+  return m_belief.size();
+}
+
+double projectedDistance(const SparseOpinion& a, const SparseOpinion& b)
+{
+  if (a.dim() != b.dim())
+  {
+    throw std::invalid_argument("Both opinions must have the same dimension!");
+  }
+
+  // Categories where either projection differs from the default one.
+  std::vector<Eigen::Index> categories;
+  for (const SparseOpinion* o : {&a, &b})
+  {
+    for (const SparseEntry& e : o->entries())
+    {
+      categories.push_back(e.first);
+    }
+    if (o == &a || a.sharedBaseRate() != b.sharedBaseRate())
+    {
+      for (const SparseEntry& e : o->sharedBaseRate()->exceptions())
+      {
+        categories.push_back(e.first);
+      }
+    }
+  }
+  std::sort(categories.begin(), categories.end());
+  categories.erase(std::unique(categories.begin(), categories.end()), categories.end());
+
+  double distance = 0.0;
+  for (Eigen::Index category : categories)
+  {
+    distance += std::abs(a.projection(category) - b.projection(category));
+  }
+
+  double remaining = static_cast<double>(a.dim() - static_cast<Eigen::Index>(categories.size()));
+  distance += remaining * std::abs(a.sharedBaseRate()->defaultValue() * a.u() -
+                                   b.sharedBaseRate()->defaultValue() * b.u());
+  return distance / 2.0;
+}
+
+double pd(const SparseOpinion& a, const SparseOpinion& b)
+{
+  return projectedDistance(a, b);
+}
+
+SparseOpinion trustDiscounting(const SparseOpinion& opinion, const double& discount_probability)
+{
+  std::vector<SparseEntry> belief(opinion.entries());
+  for (SparseEntry& e : belief)
+  {
+    e.second *= discount_probability;
+  }
+  return detail::SparseOpinionAccess::make(std::move(belief),
+                                           1.0 - discount_probability * (1.0 - opinion.u()),
+                                           opinion.sharedBaseRate());
+}
+
+SparseOpinion td(const SparseOpinion& opinion, const double& discount_probability)
+{
+  return trustDiscounting(opinion, discount_probability);
+}
+
+SparseOpinion aleatoryCumulativeBeliefFusion(const SparseOpinion& opinion_a,
+                                             const SparseOpinion& opinion_b)
+{
+  return fuse(FusionMode::CUMULATIVE, {&opinion_a, &opinion_b});
+}
+
+SparseOpinion aleatoryCumulativeBeliefFusion(const std::vector<SparseOpinion>& opinions)
+{
+  return fuse(FusionMode::CUMULATIVE, pointers(opinions));
+}
+
+SparseOpinion cbf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b)
+{
+  return aleatoryCumulativeBeliefFusion(opinion_a, opinion_b);
+}
+
+SparseOpinion cbf(const std::vector<SparseOpinion>& opinions)
+{
+  return aleatoryCumulativeBeliefFusion(opinions);
+}
+
+SparseOpinion averagingBeliefFusion(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b)
+{
+  return fuse(FusionMode::AVERAGING, {&opinion_a, &opinion_b});
+}
+
+SparseOpinion averagingBeliefFusion(const std::vector<SparseOpinion>& opinions)
+{
+  return fuse(FusionMode::AVERAGING, pointers(opinions));
+}
+
+SparseOpinion abf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b)
+{
+  return averagingBeliefFusion(opinion_a, opinion_b);
+}
+
+SparseOpinion abf(const std::vector<SparseOpinion>& opinions)
+{
+  return averagingBeliefFusion(opinions);
+}
+
+SparseOpinion weightedBeliefFusion(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b)
+{
+  return fuse(FusionMode::WEIGHTED, {&opinion_a, &opinion_b});
+}
+
+SparseOpinion weightedBeliefFusion(const std::vector<SparseOpinion>& opinions)
+{
+  return fuse(FusionMode::WEIGHTED, pointers(opinions));
+}
+
+SparseOpinion wbf(const SparseOpinion& opinion_a, const SparseOpinion& opinion_b)
+{
+  return weightedBeliefFusion(opinion_a, opinion_b);
+}
+
+SparseOpinion wbf(const std::vector<SparseOpinion>& opinions)
+{
+  return weightedBeliefFusion(opinions);
+}
+
+} // namespace subj
@@ -6,25 +6,184 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <sstream>
+#include <stdexcept>
+#include <subj/Batch.h>
 #include <subj/BinomialOpinion.h>
+#include <subj/CompactOpinions.h>
+#include <subj/DecayingOpinion.h>
+#include <subj/Dispatch.h>
+#include <subj/EvidenceIngestion.h>
+#include <subj/Executor.h>
 #include <subj/Histogram.h>
 #include <subj/MultinomialOpinion.h>
 #include <subj/Operators.h>
+#include <subj/OpinionBuffer.h>
+#include <subj/OpinionFile.h>
+#include <subj/OpinionGraph.h>
+#include <subj/OpinionIndex.h>
+#include <subj/OpinionStore.h>
+#include <subj/OwnerRegistry.h>
+#include <subj/SparseOpinion.h>
+#include <subj/SubjectiveNetwork.h>
+#include <subj/TrustNetwork.h>
+#include <utility>
 
 namespace py = pybind11;
 
+using BatchMatrixRef    = Eigen::Ref<const subj::BatchMatrix>;
+using BatchVectorRef    = Eigen::Ref<const subj::BatchVector>;
+using SegmentOffsetsRef = Eigen::Ref<const subj::SegmentOffsets>;
+using OwnerVectorRef    = Eigen::Ref<const subj::OwnerVector>;
+
+using BatchFusion = subj::OpinionBatch (*)(const BatchMatrixRef&,
+                                           const BatchVectorRef&,
+                                           const BatchMatrixRef&);
+using SegmentedBatchFusion = subj::OpinionBatch (*)(const BatchMatrixRef&,
+                                                    const BatchVectorRef&,
+                                                    const BatchMatrixRef&,
+                                                    const SegmentOffsetsRef&);
+using BatchDiscountAndFuse = subj::OpinionBatch (*)(const BatchMatrixRef&,
+                                                    const BatchVectorRef&,
+                                                    const BatchMatrixRef&,
+                                                    const BatchVectorRef&,
+                                                    subj::FusionMode);
+using SegmentedBatchDiscountAndFuse = subj::OpinionBatch (*)(const BatchMatrixRef&,
+                                                             const BatchVectorRef&,
+                                                             const BatchMatrixRef&,
+                                                             const BatchVectorRef&,
+                                                             const SegmentOffsetsRef&,
+                                                             subj::FusionMode);
+
+namespace {
+
+// Bytes of a requested buffer, which must be C-contiguous. They stay valid as long as the
+// buffer_info is alive, it holds the export of the buffer.
+std::pair<const char*, size_t> contiguousBytes(const py::buffer_info& info)
+{
+  py::ssize_t stride = info.itemsize;
+  for (py::ssize_t axis = info.ndim - 1; axis >= 0; --axis)
+  {
+    if (info.shape[axis] > 1 && info.strides[axis] != stride)
+    {
+      throw std::invalid_argument("Buffer must be C-contiguous!");
+    }
+    stride *= info.shape[axis];
+  }
+  return std::make_pair(static_cast<const char*>(info.ptr),
+                        static_cast<size_t>(info.size * info.itemsize));
+}
+
+} // namespace
+
 PYBIND11_MODULE(pysubj, m)
 {
   m.doc() = R"pbdoc(The core module of pySUBJ, a Subjective Logic Library for Python)pbdoc";
 
+  py::enum_<subj::FusionMode>(m, "FusionMode", "Fusion operator of the combined operators.")
+    .value("CUMULATIVE", subj::FusionMode::CUMULATIVE)
+    .value("AVERAGING", subj::FusionMode::AVERAGING)
+    .value("WEIGHTED", subj::FusionMode::WEIGHTED)
+    .value("CONSENSUS_AND_COMPROMISE", subj::FusionMode::CONSENSUS_AND_COMPROMISE)
+    .value("BELIEF_CONSTRAINT", subj::FusionMode::BELIEF_CONSTRAINT);
+
+  py::enum_<subj::IsaLevel>(m, "IsaLevel", "Instruction set level of the numeric kernels.")
+    .value("BASELINE", subj::IsaLevel::BASELINE)
+    .value("AVX2", subj::IsaLevel::AVX2)
+    .value("AVX512", subj::IsaLevel::AVX512);
+  m.def("supportedIsaLevel",
+        subj::supportedIsaLevel,
+        "Return the highest instruction set level supported by the CPU.");
+  m.def("isaSupported",
+        subj::isaSupported,
+        "Return whether the CPU supports the given instruction set level.");
+  m.def("isaLevel",
+        subj::isaLevel,
+        "Return the instruction set level the numeric kernels run with. It can be forced with the "
+        "environment variable SUBJ_ISA (baseline, avx2 or avx512).");
+  m.def("setIsaLevel",
+        subj::setIsaLevel,
+        "Switch the numeric kernels to the given instruction set level.");
+  m.def("isaName", subj::isaName, "Return the name of the given instruction set level.");
+
+  py::class_<subj::Executor, std::shared_ptr<subj::Executor> >(
+    m, "Executor", "Executor of the parallel operators.")
+    .def("concurrency",
+         &subj::Executor::concurrency,
+         "Return the number of threads working on a call, including the calling thread.");
+  py::class_<subj::SerialExecutor, subj::Executor, std::shared_ptr<subj::SerialExecutor> >(
+    m, "SerialExecutor", "Executor running every task in the calling thread, in order.")
+    .def(py::init());
+  py::class_<subj::WorkStealingExecutor,
+             subj::Executor,
+             std::shared_ptr<subj::WorkStealingExecutor> >(
+    m, "WorkStealingExecutor", "Work-stealing thread pool.")
+    .def(py::init<size_t>(),
+         "Create a pool of the given number of threads including the calling thread, 0 for one "
+         "per hardware thread.",
+         py::arg("threads") = 0);
+  m.def("defaultExecutor",
+        subj::defaultExecutor,
+        "Return the executor the library starts with. Its number of threads can be set with the "
+        "environment variable SUBJ_NUM_THREADS.");
+  m.def("executor", subj::executor, "Return the executor of all parallel operators.");
+  m.def("setExecutor",
+        subj::setExecutor,
+        "Replace the executor of all parallel operators, None restores the default executor.",
+        py::arg("executor"));
+
   py::class_<subj::OpinionOwner>(m, "OpinionOwner")
-    .def(py::init(), "Create an opinion owner.")
-    .def("__repr__", [](const subj::OpinionOwner& pdf) {
+    .def(py::init(), "Create an anonymous opinion owner.")
+    .def(py::init<const subj::OpinionOwner::Id&>(), "Create an opinion owner with the given id.")
+    .def("id", &subj::OpinionOwner::id, "Return the owner's id.")
+    .def("anonymous", &subj::OpinionOwner::anonymous, "Return whether the owner is anonymous.")
+    .def("__eq__", &subj::OpinionOwner::operator==)
+    .def("__ne__", &subj::OpinionOwner::operator!=)
+    .def("__hash__", &subj::OpinionOwner::id)
+    .def(py::pickle([](const subj::OpinionOwner& owner) { return py::make_tuple(owner.id()); },
+                    [](const py::tuple& state) {
+                      return subj::OpinionOwner(state[0].cast<subj::OpinionOwner::Id>());
+                    }))
+    .def("__repr__", [](const subj::OpinionOwner& owner) {
       std::stringstream stream;
-      stream << "<OpinionOwner>";
+      stream << "<OpinionOwner: " << owner.id() << ">";
       return stream.str();
     });
 
+  py::class_<subj::OwnerRegistry>(m, "OwnerRegistry")
+    .def(py::init(), "Create a registry interning owner names into compact ids.")
+    .def("intern",
+         &subj::OwnerRegistry::intern,
+         "Return the owner of the given name, registering it if necessary.")
+    .def(
+      "find",
+      [](const subj::OwnerRegistry& registry, const std::string& name) -> py::object {
+        subj::OpinionOwner owner;
+        if (!registry.find(name, owner))
+        {
+          return py::none();
+        }
+        return py::cast(owner);
+      },
+      "Return the owner of the given name or None if it is not registered.")
+    .def("name", &subj::OwnerRegistry::name, "Return the name of the given owner.")
+    .def("size", &subj::OwnerRegistry::size, "Return the number of owner ids in use.")
+    .def("__len__", &subj::OwnerRegistry::size);
+
+  py::class_<subj::OwnerTrust>(m, "OwnerTrust")
+    .def(py::init<const double&>(),
+         py::arg("default_probability") = 1.0,
+         "Create a trust table for owners with the given default discount probability.")
+    .def("setTrust",
+         &subj::OwnerTrust::setTrust,
+         "Set the discount probability of the given owner.")
+    .def("trust", &subj::OwnerTrust::trust, "Return the discount probability of the given owner.")
+    .def("defaultTrust",
+         &subj::OwnerTrust::defaultTrust,
+         "Return the discount probability of owners without an entry.")
+    .def("trustTable",
+         &subj::OwnerTrust::trustTable,
+         "Return the discount probabilities indexed by owner id as numpy array.");
+
   py::class_<subj::DirichletPDF>(m, "DirichletPDF")
     .def(py::init(), "Create a dirichlet pdf.")
     .def("updateEvidence",
@@ -32,7 +191,7 @@ PYBIND11_MODULE(pysubj, m)
            &subj::DirichletPDF::updateEvidence),
          "Update the dirichlet pdf's evidence.")
     .def("updateEvidence",
-         static_cast<void (subj::DirichletPDF::*)(const Eigen::VectorXd&)>(
+         static_cast<void (subj::DirichletPDF::*)(const Eigen::Ref<const Eigen::VectorXd>&)>(
            &subj::DirichletPDF::updateEvidence),
          "Update the dirichlet pdf's evidence.")
     .def("updateBaseRate",
@@ -40,7 +199,7 @@ PYBIND11_MODULE(pysubj, m)
            &subj::DirichletPDF::updateBaseRate),
          "Update the dirichlet pdf's base rate.")
     .def("updateBaseRate",
-         static_cast<void (subj::DirichletPDF::*)(const Eigen::VectorXd&)>(
+         static_cast<void (subj::DirichletPDF::*)(const Eigen::Ref<const Eigen::VectorXd>&)>(
            &subj::DirichletPDF::updateBaseRate),
          "Update the dirichlet pdf's base rate.")
     .def("evidence", &subj::DirichletPDF::evidence, "Return the dirichlet pdf's evidence.")
@@ -49,30 +208,49 @@ PYBIND11_MODULE(pysubj, m)
          "Return the dirichlet pdf's evidence as numpy array.")
     .def("baseRate", &subj::DirichletPDF::baseRate, "Return the dirichlet pdf's base rate.")
     .def("baseRateMat",
-         &subj::DirichletPDF::baseRate,
+         &subj::DirichletPDF::baseRateMat,
          "Return the dirichlet pdf's base rate as numpy array.")
     .def("strength", &subj::DirichletPDF::strength, "Return the dirichlet pdf's strength.")
     .def("strengthMat",
-         &subj::DirichletPDF::strength,
+         &subj::DirichletPDF::strengthMat,
          "Return the dirichlet pdf's strength as numpy array.")
     .def("density",
          static_cast<double (subj::DirichletPDF::*)(const std::vector<double>&) const>(
            &subj::DirichletPDF::density),
          "Return the dirichlet pdf's density at the given point.")
     .def("density",
-         static_cast<double (subj::DirichletPDF::*)(const Eigen::VectorXd&) const>(
-           &subj::DirichletPDF::density),
+         static_cast<double (subj::DirichletPDF::*)(
+           const Eigen::Ref<const Eigen::VectorXd>&) const>(&subj::DirichletPDF::density),
          "Return the dirichlet pdf's density at the given point.")
+    .def("logDensity",
+         &subj::DirichletPDF::logDensity,
+         "Return the log of the dirichlet pdf's density at the given point.")
+    .def("logDensities",
+         &subj::DirichletPDF::logDensities,
+         py::call_guard<py::gil_scoped_release>(),
+         "Return the log densities at the points given as rows of a numpy array.")
     .def("__repr__", [](const subj::DirichletPDF& pdf) {
       std::stringstream stream;
       stream << "<DirichletPDF: " << pdf << ">";
       return stream.str();
-    });
+    })
+    .def(py::pickle(
+      [](const subj::DirichletPDF& pdf) {
+        return py::make_tuple(pdf.evidenceMat(), pdf.baseRateMat());
+      },
+      [](const py::tuple& state) {
+        subj::DirichletPDF pdf;
+        pdf.updateEvidence(state[0].cast<Eigen::VectorXd>());
+        pdf.updateBaseRate(state[1].cast<Eigen::VectorXd>());
+        return pdf;
+      }));
 
   py::class_<subj::MultinomialOpinion>(m, "MultinomialOpinion")
     .def(py::init<const uint32_t>(), "Create a multinomial opinion with given dimension.")
     .def(py::init<const std::vector<double>&, const double&, const std::vector<double>&>())
-    .def(py::init<const Eigen::VectorXd&, const double&, const Eigen::VectorXd&>())
+    .def(py::init<const subj::MultinomialOpinion::VectorRef&,
+                  const double&,
+                  const subj::MultinomialOpinion::VectorRef&>())
     .def("update",
          static_cast<bool (subj::MultinomialOpinion::*)(
            const std::vector<double>&, const double&, const std::vector<double>&)>(
@@ -80,7 +258,9 @@ PYBIND11_MODULE(pysubj, m)
          "Update the opinion's belief, uncertainty and base rate.")
     .def("update",
          static_cast<bool (subj::MultinomialOpinion::*)(
-           const Eigen::VectorXd&, const double&, const Eigen::VectorXd&)>(
+           const subj::MultinomialOpinion::VectorRef&,
+           const double&,
+           const subj::MultinomialOpinion::VectorRef&)>(
            &subj::MultinomialOpinion::update),
          "Update the opinion's belief, uncertainty and base rate.")
     .def("updateBelief",
@@ -88,16 +268,16 @@ PYBIND11_MODULE(pysubj, m)
            &subj::MultinomialOpinion::updateBelief),
          "Update the opinion's belief.")
     .def("updateBelief",
-         static_cast<bool (subj::MultinomialOpinion::*)(const Eigen::VectorXd&)>(
-           &subj::MultinomialOpinion::updateBelief),
+         static_cast<bool (subj::MultinomialOpinion::*)(
+           const subj::MultinomialOpinion::VectorRef&)>(&subj::MultinomialOpinion::updateBelief),
          "Update the opinion's belief.")
     .def("b",
          static_cast<bool (subj::MultinomialOpinion::*)(const std::vector<double>&)>(
            &subj::MultinomialOpinion::b),
          "Update the opinion's belief.")
     .def("b",
-         static_cast<bool (subj::MultinomialOpinion::*)(const Eigen::VectorXd&)>(
-           &subj::MultinomialOpinion::b),
+         static_cast<bool (subj::MultinomialOpinion::*)(
+           const subj::MultinomialOpinion::VectorRef&)>(&subj::MultinomialOpinion::b),
          "Update the opinion's belief.")
     .def("belief", &subj::MultinomialOpinion::belief, "Return the opinion's belief.")
     .def("beliefMat",
@@ -127,16 +307,16 @@ PYBIND11_MODULE(pysubj, m)
            &subj::MultinomialOpinion::updateBaseRate),
          "Update the opinion's base rate.")
     .def("updateBaseRate",
-         static_cast<bool (subj::MultinomialOpinion::*)(const Eigen::VectorXd&)>(
-           &subj::MultinomialOpinion::updateBaseRate),
+         static_cast<bool (subj::MultinomialOpinion::*)(
+           const subj::MultinomialOpinion::VectorRef&)>(&subj::MultinomialOpinion::updateBaseRate),
          "Update the opinion's base rate.")
     .def("a",
          static_cast<bool (subj::MultinomialOpinion::*)(const std::vector<double>&)>(
            &subj::MultinomialOpinion::a),
          "Update the opinion's base rate.")
     .def("a",
-         static_cast<bool (subj::MultinomialOpinion::*)(const Eigen::VectorXd&)>(
-           &subj::MultinomialOpinion::a),
+         static_cast<bool (subj::MultinomialOpinion::*)(
+           const subj::MultinomialOpinion::VectorRef&)>(&subj::MultinomialOpinion::a),
          "Update the opinion's base rate.")
     .def("baseRate", &subj::MultinomialOpinion::baseRate, "Return the opinion's base rate.")
     .def("baseRateMat",
@@ -147,6 +327,12 @@ PYBIND11_MODULE(pysubj, m)
            &subj::MultinomialOpinion::a),
          "Return the opinion's base rate.")
     .def("aMat", &subj::MultinomialOpinion::aMat, "Return the opinion's base rate as numpy array.")
+    .def("internBaseRate",
+         &subj::MultinomialOpinion::internBaseRate,
+         "Share the base rate with all opinions holding an equal interned one.")
+    .def("sharesBaseRate",
+         &subj::MultinomialOpinion::sharesBaseRate,
+         "Return whether both opinions share the same base rate.")
     .def("owner", &subj::MultinomialOpinion::owner, "Return the opinion's owner.")
     .def("updateOwner", &subj::MultinomialOpinion::updateOwner, "Update the opinion's owner.")
     .def("dirichletPdf",
@@ -170,6 +356,10 @@ PYBIND11_MODULE(pysubj, m)
     .def("var", &subj::MultinomialOpinion::var, "Return the opinion's variance.")
     .def(
       "varMat", &subj::MultinomialOpinion::varMat, "Return the opinion's variance as numpy array.")
+    .def("evidence", &subj::MultinomialOpinion::evidence, "Return the opinion's evidence.")
+    .def("evidenceMat",
+         &subj::MultinomialOpinion::evidenceMat,
+         "Return the opinion's evidence as numpy array.")
     .def("uncertaintyMaximum",
          &subj::MultinomialOpinion::uncertaintyMaximum,
          "Return the opinion's uncertainty maximum.")
@@ -179,7 +369,23 @@ PYBIND11_MODULE(pysubj, m)
       std::stringstream stream;
       stream << "<MultinomialOpinion: " << op << ">";
       return stream.str();
-    });
+    })
+    .def(py::pickle(
+      [](const subj::MultinomialOpinion& op) {
+        return py::make_tuple(
+          op.beliefMat(), op.uncertainty(), op.baseRateMat(), op.owner().id());
+      },
+      [](const py::tuple& state) {
+        subj::MultinomialOpinion op(state[0].cast<Eigen::VectorXd>(),
+                                    state[1].cast<double>(),
+                                    state[2].cast<Eigen::VectorXd>());
+        // States pickled before opinions had owners hold three entries
+        if (state.size() > 3)
+        {
+          op.updateOwner(subj::OpinionOwner(state[3].cast<subj::OpinionOwner::Id>()));
+        }
+        return op;
+      }));
 
   py::class_<subj::BinomialOpinion, subj::MultinomialOpinion>(m, "BinomialOpinion")
     .def(py::init(), "Create a binomial opinion.")
@@ -222,6 +428,120 @@ PYBIND11_MODULE(pysubj, m)
       std::stringstream stream;
       stream << "<BinomialOpinion: " << op << ">";
       return stream.str();
+    })
+    .def(py::pickle(
+      [](const subj::BinomialOpinion& op) {
+        return py::make_tuple(
+          op.belief(), op.disbelief(), op.uncertainty(), op.baseRate(), op.owner().id());
+      },
+      [](const py::tuple& state) {
+        subj::BinomialOpinion op(state[0].cast<double>(),
+                                 state[1].cast<double>(),
+                                 state[2].cast<double>(),
+                                 state[3].cast<double>());
+        // States pickled before opinions had owners hold four entries
+        if (state.size() > 4)
+        {
+          op.updateOwner(subj::OpinionOwner(state[4].cast<subj::OpinionOwner::Id>()));
+        }
+        return op;
+      }));
+
+  py::class_<subj::DecayingOpinion>(m, "DecayingOpinion")
+    .def(py::init<const subj::MultinomialOpinion&, const double&, const double&>(),
+         py::arg("opinion"),
+         py::arg("timestamp"),
+         py::arg("half_life"),
+         "Create an opinion whose evidence decays with the given half-life.")
+    .def("opinion", &subj::DecayingOpinion::opinion, "Return the opinion at the given time.")
+    .def("at", &subj::DecayingOpinion::at, "Return the opinion at the given time.")
+    .def("fuseIn",
+         &subj::DecayingOpinion::fuseIn,
+         "Decay to the given time and fuse the observed opinion into the stored one.")
+    .def("update",
+         &subj::DecayingOpinion::update,
+         "Replace the stored opinion by the one observed at the given time.")
+    .def("storedOpinion",
+         &subj::DecayingOpinion::storedOpinion,
+         "Return the opinion as of the last update, without decay.")
+    .def("timestamp", &subj::DecayingOpinion::timestamp, "Return the time of the last update.")
+    .def("halfLife", &subj::DecayingOpinion::halfLife, "Return the half-life of the evidence.")
+    .def("decayFactor",
+         &subj::DecayingOpinion::decayFactor,
+         "Return the factor by which the evidence decays over the elapsed time.")
+    .def("dim", &subj::DecayingOpinion::dim, "Return the dimension of the opinion.")
+    .def("__repr__", [](const subj::DecayingOpinion& opinion) {
+      std::stringstream stream;
+      stream << "<DecayingOpinion: " << opinion.storedOpinion() << " at " << opinion.timestamp()
+             << ", half-life " << opinion.halfLife() << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::SparseBaseRate, std::shared_ptr<subj::SparseBaseRate> >(m, "SparseBaseRate")
+    .def(py::init<const Eigen::Index&>(), "Create a uniform base rate of the given dimension.")
+    .def(py::init<const Eigen::Index&, const std::vector<subj::SparseEntry>&>(),
+         py::arg("dimensions"),
+         py::arg("exceptions"),
+         "Create a base rate with the given (category, base rate) exceptions, all other "
+         "categories share the remaining base rate.")
+    .def("at", &subj::SparseBaseRate::at, "Return the base rate of the category.")
+    .def("defaultValue",
+         &subj::SparseBaseRate::defaultValue,
+         "Return the base rate of all categories without exception.")
+    .def("exceptions",
+         &subj::SparseBaseRate::exceptions,
+         "Return the (category, base rate) exceptions ordered by category.")
+    .def("dim", &subj::SparseBaseRate::dim, "Return the dimension of the base rate.")
+    .def("__repr__", [](const subj::SparseBaseRate& base_rate) {
+      std::stringstream stream;
+      stream << "<SparseBaseRate: " << base_rate.exceptions().size() << " exceptions, default "
+             << base_rate.defaultValue() << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::SparseOpinion>(m, "SparseOpinion")
+    .def(py::init<const Eigen::Index&>(), "Create a vacuous sparse opinion of the given dimension.")
+    .def(py::init([](const Eigen::Index& dimensions,
+                     const std::vector<subj::SparseEntry>& belief,
+                     const double& uncertainty,
+                     const std::shared_ptr<subj::SparseBaseRate>& base_rate) {
+           return subj::SparseOpinion(dimensions, belief, uncertainty, base_rate);
+         }),
+         py::arg("dimensions"),
+         py::arg("belief"),
+         py::arg("uncertainty"),
+         py::arg("base_rate") = std::shared_ptr<subj::SparseBaseRate>(),
+         "Create a sparse opinion from (category, belief) entries, with uniform base rate if none "
+         "is given.")
+    .def(py::init<const subj::MultinomialOpinion&>(),
+         "Create a sparse opinion from the non-zero beliefs of a multinomial opinion.")
+    .def("dense", &subj::SparseOpinion::dense, "Return the opinion as multinomial opinion.")
+    .def("entries",
+         &subj::SparseOpinion::entries,
+         "Return the non-zero (category, belief) entries ordered by category.")
+    .def("belief", &subj::SparseOpinion::belief, "Return the belief in the category.")
+    .def("uncertainty", &subj::SparseOpinion::uncertainty, "Return the uncertainty.")
+    .def("u", &subj::SparseOpinion::u, "Return the uncertainty.")
+    .def("baseRate", &subj::SparseOpinion::baseRate, "Return the base rate of the category.")
+    .def(
+      "sharedBaseRate",
+      [](const subj::SparseOpinion& opinion) {
+        return std::const_pointer_cast<subj::SparseBaseRate>(opinion.sharedBaseRate());
+      },
+      "Return the base rate, which may be shared with other opinions.")
+    .def("projection",
+         &subj::SparseOpinion::projection,
+         "Return the projected probability of the category.")
+    .def("mostProbable",
+         &subj::SparseOpinion::mostProbable,
+         "Return the category with the highest projected probability and that probability.")
+    .def("dim", &subj::SparseOpinion::dim, "Return the dimension of the opinion.")
+    .def("nnz", &subj::SparseOpinion::nnz, "Return the number of non-zero beliefs.")
+    .def("__repr__", [](const subj::SparseOpinion& opinion) {
+      std::stringstream stream;
+      stream << "<SparseOpinion: " << opinion.nnz() << " of " << opinion.dim()
+             << " beliefs, uncertainty " << opinion.u() << ">";
+      return stream.str();
     });
 
   py::class_<subj::Histogram>(m, "Histogram")
@@ -255,12 +575,461 @@ PYBIND11_MODULE(pysubj, m)
     .def(
       "binIndex",
       &subj::Histogram::binIndex,
-      "Returns the index of the given value for this histogram, without altering the histogram.");
+      "Returns the index of the given value for this histogram, without altering the histogram.")
+    .def(py::pickle(
+      [](const subj::Histogram& hist) {
+        return py::make_tuple(hist.histogram(), hist.intervals(), hist.dataSize());
+      },
+      [](const py::tuple& state) {
+        return subj::Histogram(state[0].cast<Eigen::Matrix<size_t, Eigen::Dynamic, 1> >(),
+                               state[1].cast<Eigen::Matrix<double, Eigen::Dynamic, 2> >(),
+                               state[2].cast<size_t>());
+      }));
+
+  py::class_<subj::OpinionBuffer>(m, "OpinionBuffer", py::buffer_protocol())
+    .def(py::init<const std::vector<subj::MultinomialOpinion>&>(),
+         "Create a contiguous binary buffer holding the given opinions of equal dimension.")
+    .def("opinions",
+         &subj::OpinionBuffer::opinions,
+         "Return the opinions stored in the buffer.")
+    .def("count", &subj::OpinionBuffer::count, "Return the number of opinions in the buffer.")
+    .def("dim", &subj::OpinionBuffer::dim, "Return the dimension of the opinions in the buffer.")
+    .def_buffer([](const subj::OpinionBuffer& buffer) {
+      return py::buffer_info(const_cast<char*>(buffer.data()),
+                             sizeof(char),
+                             py::format_descriptor<char>::format(),
+                             1,
+                             {static_cast<py::ssize_t>(buffer.size())},
+                             {static_cast<py::ssize_t>(sizeof(char))},
+                             true);
+    })
+    .def(py::pickle(
+      [](const subj::OpinionBuffer& buffer) { return py::bytes(buffer.data(), buffer.size()); },
+      [](const py::bytes& state) {
+        char* data;
+        py::ssize_t size;
+        PYBIND11_BYTES_AS_STRING_AND_SIZE(state.ptr(), &data, &size);
+        return subj::OpinionBuffer(data, static_cast<size_t>(size));
+      }))
+    .def("__repr__", [](const subj::OpinionBuffer& buffer) {
+      std::stringstream stream;
+      stream << "<OpinionBuffer: " << buffer.count() << " opinions of dimension " << buffer.dim()
+             << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::MappedOpinionFile>(m, "MappedOpinionFile")
+    .def(py::init<const std::string&>(), "Memory map the opinion file at the given path.")
+    .def("count", &subj::MappedOpinionFile::count, "Return the number of opinions in the file.")
+    .def("dim", &subj::MappedOpinionFile::dim, "Return the dimension of the opinions in the file.")
+    .def("belief",
+         &subj::MappedOpinionFile::belief,
+         py::return_value_policy::reference_internal,
+         "Return the beliefs of all opinions as read-only numpy array backed by the file.")
+    .def("uncertainty",
+         &subj::MappedOpinionFile::uncertainty,
+         py::return_value_policy::reference_internal,
+         "Return the uncertainties of all opinions as read-only numpy array backed by the file.")
+    .def("baseRate",
+         &subj::MappedOpinionFile::baseRate,
+         py::return_value_policy::reference_internal,
+         "Return the base rates of all opinions as read-only numpy array backed by the file.")
+    .def("owners",
+         &subj::MappedOpinionFile::owners,
+         py::return_value_policy::reference_internal,
+         "Return the owner ids of all opinions as read-only numpy array backed by the file.")
+    .def("opinion", &subj::MappedOpinionFile::opinion, "Return the opinion at the given index.")
+    .def("opinions",
+         &subj::MappedOpinionFile::opinions,
+         "Return the opinions in the given index range [begin, end).")
+    .def("__repr__", [](const subj::MappedOpinionFile& file) {
+      std::stringstream stream;
+      stream << "<MappedOpinionFile: " << file.count() << " opinions of dimension " << file.dim()
+             << ">";
+      return stream.str();
+    });
+
+  m.def("writeOpinionFile",
+        static_cast<void (*)(const std::string&, const std::vector<subj::MultinomialOpinion>&)>(
+          &subj::writeOpinionFile),
+        "Write the given opinions of equal dimension into a memory-mappable opinion file.");
+  m.def("writeOpinionFile",
+        static_cast<void (*)(const std::string&,
+                             const BatchMatrixRef&,
+                             const BatchVectorRef&,
+                             const BatchMatrixRef&)>(&subj::writeOpinionFile),
+        py::call_guard<py::gil_scoped_release>(),
+        "Write the opinions given as arrays of beliefs, uncertainties and base rates into a "
+        "memory-mappable opinion file.");
+  m.def("writeOpinionFile",
+        static_cast<void (*)(const std::string&,
+                             const BatchMatrixRef&,
+                             const BatchVectorRef&,
+                             const BatchMatrixRef&,
+                             const OwnerVectorRef&)>(&subj::writeOpinionFile),
+        py::call_guard<py::gil_scoped_release>(),
+        "Write the opinions given as arrays of beliefs, uncertainties, base rates and owner ids into "
+        "a memory-mappable opinion file.");
+
+  py::class_<subj::FloatOpinionColumns>(m, "FloatOpinionColumns")
+    .def(py::init<const std::vector<subj::MultinomialOpinion>&>(),
+         "Store the given opinions of equal dimension column-wise in single precision.")
+    .def(py::init<const BatchMatrixRef&, const BatchVectorRef&, const BatchMatrixRef&>(),
+         "Store the opinions given as arrays of beliefs, uncertainties and base rates in single "
+         "precision.")
+    .def("set",
+         &subj::FloatOpinionColumns::set,
+         "Replace the opinion at the given index by the given opinion.")
+    .def("opinion",
+         &subj::FloatOpinionColumns::opinion,
+         "Return the opinion at the given index.")
+    .def("opinions", &subj::FloatOpinionColumns::opinions, "Return all stored opinions.")
+    .def("batch",
+         &subj::FloatOpinionColumns::batch,
+         "Return the beliefs, uncertainties and base rates in double precision.")
+    .def("belief",
+         &subj::FloatOpinionColumns::belief,
+         py::return_value_policy::reference_internal,
+         "Return the beliefs of all opinions as read-only float32 numpy array.")
+    .def("uncertainty",
+         &subj::FloatOpinionColumns::uncertainty,
+         py::return_value_policy::reference_internal,
+         "Return the uncertainties of all opinions as read-only float32 numpy array.")
+    .def("baseRate",
+         &subj::FloatOpinionColumns::baseRate,
+         py::return_value_policy::reference_internal,
+         "Return the base rates of all opinions as read-only float32 numpy array.")
+    .def("count", &subj::FloatOpinionColumns::count, "Return the number of stored opinions.")
+    .def("dim", &subj::FloatOpinionColumns::dim, "Return the dimension of the stored opinions.")
+    .def("bytes", &subj::FloatOpinionColumns::bytes, "Return the bytes of the stored values.")
+    .def("__repr__", [](const subj::FloatOpinionColumns& columns) {
+      std::stringstream stream;
+      stream << "<FloatOpinionColumns: " << columns.count() << " opinions of dimension "
+             << columns.dim() << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::QuantizedOpinions>(m, "QuantizedOpinions")
+    .def(py::init<const std::vector<subj::MultinomialOpinion>&>(),
+         "Encode the given opinions of equal dimension as 16-bit fixed point values.")
+    .def(py::init<const BatchMatrixRef&, const BatchVectorRef&, const BatchMatrixRef&>(),
+         py::call_guard<py::gil_scoped_release>(),
+         "Encode the opinions given as arrays of beliefs, uncertainties and base rates as 16-bit "
+         "fixed point values.")
+    .def(py::init<const subj::FloatOpinionColumns&>(),
+         "Encode the given single precision opinions as 16-bit fixed point values.")
+    .def(py::init<const subj::QuantizedOpinions::CodeMatrix&,
+                  const subj::QuantizedOpinions::CodeMatrix&>(),
+         "Take mass and base rate codes, e.g. read back from an archive.")
+    .def_readonly_static("SCALE",
+                         &subj::QuantizedOpinions::SCALE,
+                         "The sum of the codes of every row.")
+    .def("opinion", &subj::QuantizedOpinions::opinion, "Decode the opinion at the given index.")
+    .def("opinions", &subj::QuantizedOpinions::opinions, "Decode all opinions.")
+    .def("batch",
+         &subj::QuantizedOpinions::batch,
+         py::call_guard<py::gil_scoped_release>(),
+         "Decode all opinions into arrays of beliefs, uncertainties and base rates.")
+    .def("columns",
+         &subj::QuantizedOpinions::columns<float>,
+         py::call_guard<py::gil_scoped_release>(),
+         "Decode all opinions into single precision columns.")
+    .def("mass",
+         &subj::QuantizedOpinions::mass,
+         py::return_value_policy::reference_internal,
+         "Return the belief and uncertainty codes as read-only uint16 numpy array.")
+    .def("baseRate",
+         &subj::QuantizedOpinions::baseRate,
+         py::return_value_policy::reference_internal,
+         "Return the base rate codes as read-only uint16 numpy array.")
+    .def("count", &subj::QuantizedOpinions::count, "Return the number of encoded opinions.")
+    .def("dim", &subj::QuantizedOpinions::dim, "Return the dimension of the encoded opinions.")
+    .def("bytes", &subj::QuantizedOpinions::bytes, "Return the bytes of the codes.")
+    .def(py::pickle(
+      [](const subj::QuantizedOpinions& opinions) {
+        return py::make_tuple(opinions.mass(), opinions.baseRate());
+      },
+      [](const py::tuple& state) {
+        return subj::QuantizedOpinions(state[0].cast<subj::QuantizedOpinions::CodeMatrix>(),
+                                       state[1].cast<subj::QuantizedOpinions::CodeMatrix>());
+      }))
+    .def("__repr__", [](const subj::QuantizedOpinions& opinions) {
+      std::stringstream stream;
+      stream << "<QuantizedOpinions: " << opinions.count() << " opinions of dimension "
+             << opinions.dim() << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::EvidenceTable>(m, "EvidenceTable")
+    .def_readonly("keys", &subj::EvidenceTable::keys, "The entity ids in order of appearance.")
+    .def_readonly("evidence", &subj::EvidenceTable::evidence, "The summed evidence per entity.")
+    .def_readonly(
+      "timestamp", &subj::EvidenceTable::timestamp, "The latest timestamp per entity.")
+    .def("__repr__", [](const subj::EvidenceTable& table) {
+      std::stringstream stream;
+      stream << "<EvidenceTable: " << table.keys.size() << " entities of dimension "
+             << table.evidence.cols() << ">";
+      return stream.str();
+    });
+
+  m.def(
+    "ingestEvidence",
+    [](const py::buffer& buffer, Eigen::Index dimensions, char delimiter, bool skip_header) {
+      py::buffer_info info                 = buffer.request();
+      std::pair<const char*, size_t> bytes = contiguousBytes(info);
+      py::gil_scoped_release release;
+      return subj::ingestEvidence(bytes.first, bytes.second, dimensions, delimiter, skip_header);
+    },
+    py::arg("data"),
+    py::arg("dimensions"),
+    py::arg("delimiter")   = ',',
+    py::arg("skip_header") = false,
+    "Aggregate the evidence of delimited lines \"entity_id,category,count[,timestamp]\" per "
+    "entity.");
+  m.def("ingestEvidenceFile",
+        &subj::ingestEvidenceFile,
+        py::arg("path"),
+        py::arg("dimensions"),
+        py::arg("delimiter")   = ',',
+        py::arg("skip_header") = false,
+        py::call_guard<py::gil_scoped_release>(),
+        "Aggregate the evidence of the delimited file at the given path per entity.");
+  m.def("evidenceOpinionBatch",
+        &subj::evidenceOpinionBatch,
+        py::call_guard<py::gil_scoped_release>(),
+        "Return the opinions of the aggregated evidence as (belief, uncertainty, base_rate).");
+  m.def("evidenceOpinions",
+        &subj::evidenceOpinions,
+        "Return the opinions of the aggregated evidence as list of MultinomialOpinion.");
+
+  py::class_<subj::OpinionGraph>(m, "OpinionGraph")
+    .def(py::init(), "Create an empty dataflow graph of derived opinions.")
+    .def("addInput", &subj::OpinionGraph::addInput, "Add an input node holding the opinion.")
+    .def("addCumulativeFusion",
+         &subj::OpinionGraph::addCumulativeFusion,
+         "Add a node fusing the given nodes by aleatory cumulative belief fusion.")
+    .def("addAveragingFusion",
+         &subj::OpinionGraph::addAveragingFusion,
+         "Add a node fusing the given nodes by averaging belief fusion.")
+    .def("addTrustDiscounting",
+         &subj::OpinionGraph::addTrustDiscounting,
+         "Add a node discounting the given node with the discount probability.")
+    .def("addDeduction",
+         &subj::OpinionGraph::addDeduction,
+         "Add a node deducing the given opinion node through the conditional opinion nodes.")
+    .def("addNormalMultiplication",
+         &subj::OpinionGraph::addNormalMultiplication,
+         "Add a node multiplying the two given nodes.")
+    .def("setInput",
+         &subj::OpinionGraph::setInput,
+         "Replace the opinion of an input node and mark its dependents dirty.")
+    .def("setDiscountProbability",
+         &subj::OpinionGraph::setDiscountProbability,
+         "Replace the probability of a trust discounting node and mark it dirty.")
+    .def("update",
+         &subj::OpinionGraph::update,
+         "Recompute all dirty nodes and return their number.")
+    .def("value", &subj::OpinionGraph::value, "Return the up to date value of the node.")
+    .def("dirty", &subj::OpinionGraph::dirty, "Return whether the node has to be recomputed.")
+    .def("inputs", &subj::OpinionGraph::inputs, "Return the input nodes of the node.")
+    .def("size", &subj::OpinionGraph::size, "Return the number of nodes.")
+    .def("__len__", &subj::OpinionGraph::size)
+    .def("__repr__", [](const subj::OpinionGraph& graph) {
+      std::stringstream stream;
+      stream << "<OpinionGraph: " << graph.size() << " nodes>";
+      return stream.str();
+    });
+
+  py::class_<subj::OpinionIndex>(m, "OpinionIndex")
+    .def(py::init<const Eigen::Index&>(),
+         "Create a collection of opinions of the given dimension with ordered indexes on "
+         "projected probabilities and uncertainty.")
+    .def("put", &subj::OpinionIndex::put, "Insert or replace the opinion for the given key.")
+    .def("erase", &subj::OpinionIndex::erase, "Remove the opinion for the given key.")
+    .def("get", &subj::OpinionIndex::get, "Return the opinion for the given key.")
+    .def("contains",
+         &subj::OpinionIndex::contains,
+         "Return whether an opinion is indexed for the given key.")
+    .def("__contains__", &subj::OpinionIndex::contains)
+    .def("size", &subj::OpinionIndex::size, "Return the number of indexed opinions.")
+    .def("__len__", &subj::OpinionIndex::size)
+    .def("dim", &subj::OpinionIndex::dim, "Return the dimension of the indexed opinions.")
+    .def("topProjection",
+         &subj::OpinionIndex::topProjection,
+         "Return the keys of the k opinions with the highest projected probability of the "
+         "category.")
+    .def("bottomProjection",
+         &subj::OpinionIndex::bottomProjection,
+         "Return the keys of the k opinions with the lowest projected probability of the "
+         "category.")
+    .def("projectionRange",
+         &subj::OpinionIndex::projectionRange,
+         "Return the keys of the opinions whose projected probability of the category is in "
+         "[low, high].")
+    .def("topUncertainty",
+         &subj::OpinionIndex::topUncertainty,
+         "Return the keys of the k most uncertain opinions.")
+    .def("bottomUncertainty",
+         &subj::OpinionIndex::bottomUncertainty,
+         "Return the keys of the k least uncertain opinions.")
+    .def("uncertaintyRange",
+         &subj::OpinionIndex::uncertaintyRange,
+         "Return the keys of the opinions whose uncertainty is in [low, high].")
+    .def("__repr__", [](const subj::OpinionIndex& index) {
+      std::stringstream stream;
+      stream << "<OpinionIndex: " << index.size() << " opinions of dimension " << index.dim()
+             << ">";
+      return stream.str();
+    });
+
+  py::class_<subj::OpinionStore>(m, "OpinionStore")
+    .def(py::init<size_t>(),
+         py::arg("shard_count") = subj::OpinionStore::DEFAULT_SHARD_COUNT,
+         "Create a thread-safe store of opinions by key with the given number of shards.")
+    .def("put",
+         &subj::OpinionStore::put,
+         py::call_guard<py::gil_scoped_release>(),
+         "Store the opinion for the given key, replacing a previous one.")
+    .def("fuseIn",
+         &subj::OpinionStore::fuseIn,
+         py::call_guard<py::gil_scoped_release>(),
+         "Fuse the opinion into the stored one by aleatory cumulative belief fusion and return "
+         "the result.")
+    .def("discount",
+         &subj::OpinionStore::discount,
+         py::call_guard<py::gil_scoped_release>(),
+         "Apply trust discounting to the stored opinion, return False if the key is not present.")
+    .def("get",
+         static_cast<subj::MultinomialOpinion (subj::OpinionStore::*)(const std::string&) const>(
+           &subj::OpinionStore::get),
+         py::call_guard<py::gil_scoped_release>(),
+         "Return the stored opinion for the given key.")
+    .def("contains",
+         &subj::OpinionStore::contains,
+         "Return whether an opinion is stored for the given key.")
+    .def("__contains__", &subj::OpinionStore::contains)
+    .def("erase", &subj::OpinionStore::erase, "Remove the opinion stored for the given key.")
+    .def("size", &subj::OpinionStore::size, "Return the number of stored opinions.")
+    .def("__len__", &subj::OpinionStore::size)
+    .def("shardCount", &subj::OpinionStore::shardCount, "Return the number of shards.")
+    .def("keys", &subj::OpinionStore::keys, "Return the keys of all stored opinions.")
+    .def("__repr__", [](const subj::OpinionStore& store) {
+      std::stringstream stream;
+      stream << "<OpinionStore: " << store.size() << " opinions in " << store.shardCount()
+             << " shards>";
+      return stream.str();
+    });
+
+  py::class_<subj::SubjectiveNetwork>(m, "SubjectiveNetwork")
+    .def(py::init(), "Create an empty subjective network.")
+    .def("addVariable",
+         &subj::SubjectiveNetwork::addVariable,
+         "Add a root variable with the given number of states and return its id.")
+    .def("setConditionals",
+         &subj::SubjectiveNetwork::setConditionals,
+         "Make the variable a child of the given parents with conditional opinions indexed by the "
+         "joint parent state.")
+    .def("setEvidence",
+         &subj::SubjectiveNetwork::setEvidence,
+         "Set the evidence opinion of a root variable.")
+    .def("compile",
+         &subj::SubjectiveNetwork::compile,
+         "Order the variables and precompute the deduction state.")
+    .def("evaluate",
+         &subj::SubjectiveNetwork::evaluate,
+         "Compute the marginals of all dirty variables and return their number.")
+    .def("marginal",
+         &subj::SubjectiveNetwork::marginal,
+         "Return the marginal opinion of the variable.")
+    .def("parents", &subj::SubjectiveNetwork::parents, "Return the parents of the variable.")
+    .def("dim", &subj::SubjectiveNetwork::dim, "Return the number of states of the variable.")
+    .def("dirty",
+         &subj::SubjectiveNetwork::dirty,
+         "Return whether the marginal of the variable has to be recomputed.")
+    .def("size", &subj::SubjectiveNetwork::size, "Return the number of variables.")
+    .def("__len__", &subj::SubjectiveNetwork::size)
+    .def("__repr__", [](const subj::SubjectiveNetwork& network) {
+      std::stringstream stream;
+      stream << "<SubjectiveNetwork: " << network.size() << " variables>";
+      return stream.str();
+    });
+
+  py::class_<subj::TrustNetwork>(m, "TrustNetwork")
+    .def(py::init<const subj::TrustNetwork::AgentId&>(),
+         py::arg("agent_count") = 0,
+         "Create a trust network with the given number of agents.")
+    .def("addAgent", &subj::TrustNetwork::addAgent, "Add an agent and return its id.")
+    .def("agentCount", &subj::TrustNetwork::agentCount, "Return the number of agents.")
+    .def("setTrust",
+         &subj::TrustNetwork::setTrust,
+         "Set the binomial trust opinion of the truster in the trustee.")
+    .def("removeTrust",
+         &subj::TrustNetwork::removeTrust,
+         "Remove the trust of the truster in the trustee.")
+    .def("hasTrust",
+         &subj::TrustNetwork::hasTrust,
+         "Return whether the truster holds direct trust in the trustee.")
+    .def("trust",
+         &subj::TrustNetwork::trust,
+         "Return the direct trust of the truster in the trustee.")
+    .def("setOpinion",
+         &subj::TrustNetwork::setOpinion,
+         "Set the functional opinion held by the agent.")
+    .def("hasOpinion",
+         &subj::TrustNetwork::hasOpinion,
+         "Return whether the agent holds a functional opinion.")
+    .def("derivedTrust",
+         &subj::TrustNetwork::derivedTrust,
+         "Return the trust of the analyst in the agent, fused over all shortest trust paths.")
+    .def("discountedOpinion",
+         &subj::TrustNetwork::discountedOpinion,
+         "Return the opinion of the source discounted by the derived trust of the analyst.")
+    .def("discountedOpinions",
+         &subj::TrustNetwork::discountedOpinions,
+         "Evaluate a list of (analyst, source) queries in parallel.")
+    .def("fusedOpinion",
+         &subj::TrustNetwork::fusedOpinion,
+         "Return the fusion of the discounted opinions of all sources reachable from the "
+         "analyst.")
+    .def("clearCache", &subj::TrustNetwork::clearCache, "Drop all memoized derived trust.")
+    .def("__repr__", [](const subj::TrustNetwork& network) {
+      std::stringstream stream;
+      stream << "<TrustNetwork: " << network.agentCount() << " agents>";
+      return stream.str();
+    });
+
+  m.def(
+    "toBytes",
+    [](const std::vector<subj::MultinomialOpinion>& opinions) {
+      return subj::OpinionBuffer(opinions);
+    },
+    "Serialize the given opinions of equal dimension into one contiguous binary buffer, which "
+    "supports the buffer protocol (e.g. memoryview or bytes).");
+  m.def(
+    "fromBytes",
+    [](const py::buffer& buffer) {
+      py::buffer_info info                 = buffer.request();
+      std::pair<const char*, size_t> bytes = contiguousBytes(info);
+      py::gil_scoped_release release;
+      return subj::opinionsFromBytes(bytes.first, bytes.second);
+    },
+    "Deserialize the opinions from a buffer created with toBytes.");
 
   m.def("projectedDistance",
-        subj::projectedDistance,
+        static_cast<double (*)(const subj::MultinomialOpinion&, const subj::MultinomialOpinion&)>(
+          &subj::projectedDistance),
         "Calculates the projected distance of two given opinions.");
-  m.def("pd", subj::pd, "Calculates the projected distance of two given opinions.");
+  m.def("projectedDistance",
+        static_cast<double (*)(const subj::SparseOpinion&, const subj::SparseOpinion&)>(
+          &subj::projectedDistance),
+        "Calculates the projected distance of two given sparse opinions.");
+  m.def("pd",
+        static_cast<double (*)(const subj::MultinomialOpinion&, const subj::MultinomialOpinion&)>(
+          &subj::pd),
+        "Calculates the projected distance of two given opinions.");
+  m.def("pd",
+        static_cast<double (*)(const subj::SparseOpinion&, const subj::SparseOpinion&)>(&subj::pd),
+        "Calculates the projected distance of two given sparse opinions.");
   m.def("conjunctiveCertainty",
         subj::conjunctiveCertainty,
         "Calculates the conjunctive certainty of two given opinions.");
@@ -270,9 +1039,22 @@ PYBIND11_MODULE(pysubj, m)
         "Calculates the degree of conflict of two given opinions.");
   m.def("doc", subj::doc, "Calculates the degree of conflict of two given opinions.");
   m.def("averagingBeliefFusion",
-        subj::averagingBeliefFusion,
+        static_cast<subj::MultinomialOpinion (*)(const std::vector<subj::MultinomialOpinion>&)>(
+          &subj::averagingBeliefFusion),
+        "Calculates the averaging belief fusion of multiple given opinions.");
+  m.def("averagingBeliefFusion",
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
+                                                 const subj::MultinomialOpinion&)>(
+          &subj::averagingBeliefFusion),
+        "Calculates the averaging belief fusion of two given opinions.");
+  m.def("abf",
+        static_cast<subj::MultinomialOpinion (*)(const std::vector<subj::MultinomialOpinion>&)>(
+          &subj::abf),
         "Calculates the averaging belief fusion of multiple given opinions.");
-  m.def("abf", subj::abf, "Calculates the averaging belief fusion of multiple given opinions.");
+  m.def("abf",
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
+                                                 const subj::MultinomialOpinion&)>(&subj::abf),
+        "Calculates the averaging belief fusion of two given opinions.");
   m.def("aleatoryCumulativeBeliefFusion",
         static_cast<subj::MultinomialOpinion (*)(const std::vector<subj::MultinomialOpinion>&)>(
           &subj::aleatoryCumulativeBeliefFusion),
@@ -290,16 +1072,119 @@ PYBIND11_MODULE(pysubj, m)
         static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
                                                  const subj::MultinomialOpinion&)>(&subj::cbf),
         "Calculates the aleatory cumulative belief fusion of two given opinions.");
+  m.def("weightedBeliefFusion",
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
+                                                 const subj::MultinomialOpinion&)>(
+          &subj::weightedBeliefFusion),
+        "Calculates the weighted belief fusion of two given opinions.");
+  m.def("wbf",
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
+                                                 const subj::MultinomialOpinion&)>(&subj::wbf),
+        "Calculates the weighted belief fusion of two given opinions.");
+  m.def("weightedBeliefFusion",
+        static_cast<subj::MultinomialOpinion (*)(const std::vector<subj::MultinomialOpinion>&)>(
+          &subj::weightedBeliefFusion),
+        "Calculates the weighted belief fusion of multiple given opinions.");
+  m.def("wbf",
+        static_cast<subj::MultinomialOpinion (*)(const std::vector<subj::MultinomialOpinion>&)>(
+          &subj::wbf),
+        "Calculates the weighted belief fusion of multiple given opinions.");
+  m.def("consensusAndCompromiseFusion",
+        subj::consensusAndCompromiseFusion,
+        "Calculates the consensus and compromise fusion of multiple given opinions.");
+  m.def("ccf",
+        subj::ccf,
+        "Calculates the consensus and compromise fusion of multiple given opinions.");
+  m.def("beliefConstraintFusion",
+        subj::beliefConstraintFusion,
+        "Calculates the belief constraint fusion of multiple given opinions.");
+  m.def("bcf", subj::bcf, "Calculates the belief constraint fusion of multiple given opinions.");
   m.def("cumulativeUnfusion",
-        subj::cumulativeUnfusion,
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&,
+                                                 const subj::MultinomialOpinion&,
+                                                 const Eigen::VectorXd&)>(
+          &subj::cumulativeUnfusion),
         "Calculates the cumulative unfusion of a given opinion from a fused opinion with given "
         "base rate.");
   m.def("trustDiscounting",
-        subj::trustDiscounting,
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&, const double&)>(
+          &subj::trustDiscounting),
         "Calculates the trust discounted opinion of a given opinion and a discount probability.");
   m.def("td",
-        subj::td,
+        static_cast<subj::MultinomialOpinion (*)(const subj::MultinomialOpinion&, const double&)>(
+          &subj::td),
         "Calculates the trust discounted opinion of a given opinion and a discount probability.");
+  m.def("aleatoryCumulativeBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::aleatoryCumulativeBeliefFusion),
+        "Calculates the aleatory cumulative belief fusion of multiple given sparse opinions.");
+  m.def("aleatoryCumulativeBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(
+          &subj::aleatoryCumulativeBeliefFusion),
+        "Calculates the aleatory cumulative belief fusion of two given sparse opinions.");
+  m.def("cbf",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::cbf),
+        "Calculates the aleatory cumulative belief fusion of multiple given sparse opinions.");
+  m.def("cbf",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(&subj::cbf),
+        "Calculates the aleatory cumulative belief fusion of two given sparse opinions.");
+  m.def("averagingBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::averagingBeliefFusion),
+        "Calculates the averaging belief fusion of multiple given sparse opinions.");
+  m.def("averagingBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(
+          &subj::averagingBeliefFusion),
+        "Calculates the averaging belief fusion of two given sparse opinions.");
+  m.def("abf",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::abf),
+        "Calculates the averaging belief fusion of multiple given sparse opinions.");
+  m.def("abf",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(&subj::abf),
+        "Calculates the averaging belief fusion of two given sparse opinions.");
+  m.def("weightedBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::weightedBeliefFusion),
+        "Calculates the weighted belief fusion of multiple given sparse opinions.");
+  m.def("weightedBeliefFusion",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(
+          &subj::weightedBeliefFusion),
+        "Calculates the weighted belief fusion of two given sparse opinions.");
+  m.def("wbf",
+        static_cast<subj::SparseOpinion (*)(const std::vector<subj::SparseOpinion>&)>(
+          &subj::wbf),
+        "Calculates the weighted belief fusion of multiple given sparse opinions.");
+  m.def("wbf",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&,
+                                            const subj::SparseOpinion&)>(&subj::wbf),
+        "Calculates the weighted belief fusion of two given sparse opinions.");
+  m.def("trustDiscounting",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&, const double&)>(
+          &subj::trustDiscounting),
+        "Calculates the trust discounted sparse opinion of a given sparse opinion and a discount "
+        "probability.");
+  m.def("td",
+        static_cast<subj::SparseOpinion (*)(const subj::SparseOpinion&, const double&)>(
+          &subj::td),
+        "Calculates the trust discounted sparse opinion of a given sparse opinion and a discount "
+        "probability.");
+  m.def("discountAndFuse",
+        subj::discountAndFuse,
+        py::arg("opinions"),
+        py::arg("discount_probabilities"),
+        py::arg("mode") = subj::FusionMode::CUMULATIVE,
+        "Calculates the fusion of the given opinions, each trust discounted by its discount "
+        "probability, in one pass.");
+  m.def("evidenceDecay",
+        subj::evidenceDecay,
+        "Calculates the opinion with the evidence of a given opinion scaled by a decay factor.");
   m.def("normalMultiplication",
         subj::normalMultiplication,
         "Calculates the normal multiplication of two given opinions.");
@@ -307,6 +1192,197 @@ PYBIND11_MODULE(pysubj, m)
         subj::deduction,
         "Calculates the deduction of a given opinion and a list of conditional opinions.");
 
+  // Batched operators on numpy arrays. All of them release the GIL while computing.
+  m.def("batchAveragingBeliefFusion",
+        static_cast<BatchFusion>(&subj::batchAveragingBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the averaging belief fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchAveragingBeliefFusion",
+        static_cast<SegmentedBatchFusion>(&subj::batchAveragingBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the averaging belief fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchAbf",
+        static_cast<BatchFusion>(&subj::batchAbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the averaging belief fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchAbf",
+        static_cast<SegmentedBatchFusion>(&subj::batchAbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the averaging belief fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchAleatoryCumulativeBeliefFusion",
+        static_cast<BatchFusion>(&subj::batchAleatoryCumulativeBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the aleatory cumulative belief fusion of all opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchAleatoryCumulativeBeliefFusion",
+        static_cast<SegmentedBatchFusion>(&subj::batchAleatoryCumulativeBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the aleatory cumulative belief fusion of each segment of opinions given as "
+        "arrays of beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchCbf",
+        static_cast<BatchFusion>(&subj::batchCbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the aleatory cumulative belief fusion of all opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchCbf",
+        static_cast<SegmentedBatchFusion>(&subj::batchCbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the aleatory cumulative belief fusion of each segment of opinions given as "
+        "arrays of beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchWeightedBeliefFusion",
+        static_cast<BatchFusion>(&subj::batchWeightedBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the weighted belief fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchWeightedBeliefFusion",
+        static_cast<SegmentedBatchFusion>(&subj::batchWeightedBeliefFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the weighted belief fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchWbf",
+        static_cast<BatchFusion>(&subj::batchWbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the weighted belief fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchWbf",
+        static_cast<SegmentedBatchFusion>(&subj::batchWbf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the weighted belief fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchConsensusAndCompromiseFusion",
+        static_cast<BatchFusion>(&subj::batchConsensusAndCompromiseFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the consensus and compromise fusion of all opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchConsensusAndCompromiseFusion",
+        static_cast<SegmentedBatchFusion>(&subj::batchConsensusAndCompromiseFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the consensus and compromise fusion of each segment of opinions given as "
+        "arrays of beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchCcf",
+        static_cast<BatchFusion>(&subj::batchCcf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the consensus and compromise fusion of all opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchCcf",
+        static_cast<SegmentedBatchFusion>(&subj::batchCcf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the consensus and compromise fusion of each segment of opinions given as "
+        "arrays of beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchBeliefConstraintFusion",
+        static_cast<BatchFusion>(&subj::batchBeliefConstraintFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the belief constraint fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchBeliefConstraintFusion",
+        static_cast<SegmentedBatchFusion>(&subj::batchBeliefConstraintFusion),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the belief constraint fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchBcf",
+        static_cast<BatchFusion>(&subj::batchBcf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the belief constraint fusion of all opinions given as arrays of beliefs, "
+        "uncertainties and base rates. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchBcf",
+        static_cast<SegmentedBatchFusion>(&subj::batchBcf),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the belief constraint fusion of each segment of opinions given as arrays of "
+        "beliefs, uncertainties and base rates. Segment i covers the rows offsets[i] to "
+        "offsets[i + 1]. Returns a tuple (belief, uncertainty, base rate) with one row per "
+        "segment.");
+  m.def("batchDiscountAndFuse",
+        static_cast<BatchDiscountAndFuse>(&subj::batchDiscountAndFuse),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the fusion of all opinions given as arrays of beliefs, uncertainties and base "
+        "rates, trust discounted by either one discount probability or one per opinion. Returns "
+        "a tuple (belief, uncertainty, base rate).");
+  m.def("batchDiscountAndFuse",
+        static_cast<SegmentedBatchDiscountAndFuse>(&subj::batchDiscountAndFuse),
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the fusion of each segment of opinions given as arrays of beliefs, "
+        "uncertainties and base rates, trust discounted by either one discount probability or "
+        "one per opinion. Segment i covers the rows offsets[i] to offsets[i + 1]. Returns a tuple "
+        "(belief, uncertainty, base rate) with one row per segment.");
+  m.def("batchTrustDiscounting",
+        subj::batchTrustDiscounting,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the trust discounted opinions of the given opinions and either one discount "
+        "probability or one per opinion. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("batchTd",
+        subj::batchTd,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the trust discounted opinions of the given opinions and either one discount "
+        "probability or one per opinion. Returns a tuple (belief, uncertainty, base rate).");
+  m.def("ownerTrustDiscounting",
+        &subj::ownerTrustDiscounting,
+        py::call_guard<py::gil_scoped_release>(),
+        "Discount every opinion by the trust in its owner.");
+  m.def("batchOwnerTrustDiscounting",
+        &subj::batchOwnerTrustDiscounting,
+        py::call_guard<py::gil_scoped_release>(),
+        "Discount a batch of opinions by the trust in the owner of each row, given as array of "
+        "owner ids.");
+  m.def("batchProjection",
+        subj::batchProjection,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the projections of the given opinions.");
+  m.def("batchProjectedDistance",
+        subj::batchProjectedDistance,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the projected distances of two equally sized batches of opinions row by row.");
+  m.def("batchPd",
+        subj::batchPd,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the projected distances of two equally sized batches of opinions row by row.");
+  m.def("batchDeduction",
+        subj::batchDeduction,
+        py::call_guard<py::gil_scoped_release>(),
+        "Calculates the deduction of each given opinion and the same conditional opinions, given "
+        "as arrays of conditional beliefs and uncertainties. Returns a tuple (belief, "
+        "uncertainty, base rate).");
+
+  // Element-wise binomial kernels writing into given numpy arrays. They are wrapped in
+  // pysubj.ufunc, which takes care of broadcasting and output allocation.
+  py::module_ kernels = m.def_submodule("_kernels", "Element-wise kernels used by pysubj.ufunc.");
+  kernels.def("averagingBeliefFusion",
+              subj::batchBinomialAveragingBeliefFusion,
+              py::call_guard<py::gil_scoped_release>());
+  kernels.def("aleatoryCumulativeBeliefFusion",
+              subj::batchBinomialAleatoryCumulativeBeliefFusion,
+              py::call_guard<py::gil_scoped_release>());
+  kernels.def("trustDiscounting",
+              subj::batchBinomialTrustDiscounting,
+              py::call_guard<py::gil_scoped_release>());
+  kernels.def(
+    "projection", subj::batchBinomialProjection, py::call_guard<py::gil_scoped_release>());
+  kernels.def("variance", subj::batchBinomialVariance, py::call_guard<py::gil_scoped_release>());
+  kernels.def("degreeOfConflict",
+              subj::batchBinomialDegreeOfConflict,
+              py::call_guard<py::gil_scoped_release>());
+
 #ifdef VERSION_INFO
   m.attr("__version__") = STRINGIFY(VERSION_INFO);
 #endif
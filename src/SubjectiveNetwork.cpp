@@ -0,0 +1,346 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/SubjectiveNetwork.h>
+
+#include <subj/Operators.h>
+
+#include "DeductionKernel.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+// Variables of one level handed to a single thread
+const size_t NETWORK_GRAIN_SIZE = 16;
+
+} // namespace
+
+SubjectiveNetwork::SubjectiveNetwork()
+  : m_compiled(true)
+{
+}
+
+SubjectiveNetwork::VariableId SubjectiveNetwork::addVariable(const Eigen::Index& dimensions)
+{
+  if (dimensions < 1)
+  {
+    throw std::invalid_argument("A variable needs at least one state");
+  }
+  Variable variable = {dimensions,
+                       {},
+                       {},
+                       {},
+                       nullptr,
+                       MultinomialOpinion(static_cast<uint32_t>(dimensions)),
+                       0,
+                       false};
+  m_variables.push_back(variable);
+  return m_variables.size() - 1;
+}
+
+void SubjectiveNetwork::setConditionals(const VariableId& variable,
+                                        const std::vector<VariableId>& parents,
+                                        const std::vector<MultinomialOpinion>& conditionals)
+{
+  checkVariable(variable);
+  Variable& v = m_variables[variable];
+
+  size_t joint_dim = parents.empty() ? 0 : 1;
+  for (const VariableId& parent : parents)
+  {
+    checkVariable(parent);
+    if (parent == variable)
+    {
+      throw std::invalid_argument("A variable cannot be its own parent");
+    }
+    joint_dim *= static_cast<size_t>(m_variables[parent].dim);
+  }
+  if (conditionals.size() != joint_dim)
+  {
+    throw std::invalid_argument("One conditional opinion per joint parent state must be given!");
+  }
+  for (const MultinomialOpinion& conditional : conditionals)
+  {
+    if (conditional.dim() != v.dim)
+    {
+      throw std::invalid_argument("The conditional opinions must have the variable's dimension!");
+    }
+  }
+
+  for (const VariableId& parent : v.parents)
+  {
+    std::vector<VariableId>& children = m_variables[parent].children;
+    children.erase(std::remove(children.begin(), children.end(), variable), children.end());
+  }
+  for (const VariableId& parent : parents)
+  {
+    std::vector<VariableId>& children = m_variables[parent].children;
+    if (std::find(children.begin(), children.end(), variable) == children.end())
+    {
+      children.push_back(variable);
+    }
+  }
+
+  v.parents      = parents;
+  v.conditionals = conditionals;
+  v.deduction.reset();
+  if (parents.empty())
+  {
+    v.marginal = MultinomialOpinion(static_cast<uint32_t>(v.dim));
+  }
+  m_compiled = false;
+}
+
+void SubjectiveNetwork::setEvidence(const VariableId& variable, const MultinomialOpinion& opinion)
+{
+  checkVariable(variable);
+  Variable& v = m_variables[variable];
+  if (!v.parents.empty())
+  {
+    throw std::invalid_argument("Evidence can only be set on root variables");
+  }
+  if (opinion.dim() != v.dim)
+  {
+    throw std::invalid_argument("The evidence must have the variable's dimension!");
+  }
+  v.marginal = opinion;
+  for (const VariableId& child : v.children)
+  {
+    markDirty(child);
+  }
+}
+
+void SubjectiveNetwork::compile()
+{
+  // Kahn's algorithm, the level of a variable is one above its highest parent
+  std::vector<size_t> pending(m_variables.size());
+  std::vector<VariableId> order;
+  order.reserve(m_variables.size());
+  for (VariableId i = 0; i < m_variables.size(); ++i)
+  {
+    pending[i] = m_variables[i].parents.size();
+    if (pending[i] == 0)
+    {
+      m_variables[i].level = 0;
+      order.push_back(i);
+    }
+  }
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    Variable& v = m_variables[order[i]];
+    for (const VariableId& child : v.children)
+    {
+      if (--pending[child] == 0)
+      {
+        size_t level = 0;
+        for (const VariableId& parent : m_variables[child].parents)
+        {
+          level = std::max(level, m_variables[parent].level + 1);
+        }
+        m_variables[child].level = level;
+        order.push_back(child);
+      }
+    }
+  }
+  if (order.size() != m_variables.size())
+  {
+    throw std::invalid_argument("The subjective network contains a cycle");
+  }
+
+  m_dirty.clear();
+  for (VariableId i = 0; i < m_variables.size(); ++i)
+  {
+    Variable& v = m_variables[i];
+    if (v.parents.empty())
+    {
+      v.dirty = false;
+      continue;
+    }
+    if (!v.deduction)
+    {
+      BatchMatrix belief(static_cast<Eigen::Index>(v.conditionals.size()), v.dim);
+      BatchVector uncertainty(static_cast<Eigen::Index>(v.conditionals.size()));
+      for (size_t i = 0; i < v.conditionals.size(); ++i)
+      {
+        belief.row(static_cast<Eigen::Index>(i)) = v.conditionals[i].beliefMat().transpose();
+        uncertainty(static_cast<Eigen::Index>(i)) = v.conditionals[i].uncertainty();
+      }
+      v.deduction = std::make_shared<detail::DeductionState>(belief, uncertainty);
+    }
+    v.dirty = true;
+    m_dirty.push_back(i);
+  }
+  m_compiled = true;
+}
+
+size_t SubjectiveNetwork::evaluate()
+{
+  if (!m_compiled)
+  {
+    compile();
+  }
+  if (m_dirty.empty())
+  {
+    return 0;
+  }
+
+  std::sort(m_dirty.begin(), m_dirty.end(), [this](const VariableId& a, const VariableId& b) {
+    return m_variables[a].level < m_variables[b].level;
+  });
+
+  // Variables of the same level never depend on each other
+  size_t begin = 0;
+  while (begin < m_dirty.size())
+  {
+    size_t level = m_variables[m_dirty[begin]].level;
+    size_t end   = begin;
+    while (end < m_dirty.size() && m_variables[m_dirty[end]].level == level)
+    {
+      ++end;
+    }
+
+    detail::parallelFor(
+      end - begin,
+      [&](size_t first, size_t last) {
+        for (size_t i = begin + first; i < begin + last; ++i)
+        {
+          evaluateVariable(m_variables[m_dirty[i]]);
+        }
+      },
+      NETWORK_GRAIN_SIZE);
+
+    begin = end;
+  }
+
+  for (const VariableId& variable : m_dirty)
+  {
+    m_variables[variable].dirty = false;
+  }
+  size_t count = m_dirty.size();
+  m_dirty.clear();
+  return count;
+}
+
+const MultinomialOpinion& SubjectiveNetwork::marginal(const VariableId& variable)
+{
+  checkVariable(variable);
+  evaluate();
+  return m_variables[variable].marginal;
+}
+
+const std::vector<SubjectiveNetwork::VariableId>& SubjectiveNetwork::parents(
+  const VariableId& variable) const
+{
+  checkVariable(variable);
+  return m_variables[variable].parents;
+}
+
+Eigen::Index SubjectiveNetwork::dim(const VariableId& variable) const
+{
+  checkVariable(variable);
+  return m_variables[variable].dim;
+}
+
+bool SubjectiveNetwork::dirty(const VariableId& variable) const
+{
+  checkVariable(variable);
+  return !m_compiled || m_variables[variable].dirty;
+}
+
+size_t SubjectiveNetwork::size() const
+{
+  return m_variables.size();
+}
+
+void SubjectiveNetwork::checkVariable(const VariableId& variable) const
+{
+  if (variable >= m_variables.size())
+  {
+    throw std::out_of_range("Unknown subjective network variable");
+  }
+}
+
+void SubjectiveNetwork::markDirty(const VariableId& variable)
+{
+  std::vector<VariableId> stack(1, variable);
+  while (!stack.empty())
+  {
+    VariableId id = stack.back();
+    Variable& v   = m_variables[id];
+    stack.pop_back();
+    if (v.dirty)
+    {
+      continue;
+    }
+    v.dirty = true;
+    m_dirty.push_back(id);
+    stack.insert(stack.end(), v.children.begin(), v.children.end());
+  }
+}
+
+void SubjectiveNetwork::evaluateVariable(Variable& variable) const
+{
+  MultinomialOpinion joint = m_variables[variable.parents[0]].marginal;
+  for (size_t i = 1; i < variable.parents.size(); ++i)
+  {
+    joint = normalMultiplication(joint, m_variables[variable.parents[i]].marginal);
+  }
+
+  const detail::DeductionState& state = *variable.deduction;
+  MultinomialOpinion::Vector belief(variable.dim);
+  MultinomialOpinion::Vector base_rate(variable.dim);
+  double uncertainty;
+  detail::DeductionWorkspace workspace(state.belief.rows(), variable.dim);
+  detail::deduceRow(joint.beliefMat().transpose(),
+                    joint.uncertainty(),
+                    joint.baseRateMat().transpose(),
+                    state.belief,
+                    state.uncertainty,
+                    state.belief_column_min,
+                    workspace,
+                    belief.transpose(),
+                    uncertainty,
+                    base_rate.transpose());
+  variable.marginal.update(belief, uncertainty, base_rate);
+}
+
+} // namespace subj
@@ -0,0 +1,441 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/TrustNetwork.h>
+
+#include <subj/Operators.h>
+
+#include "BinomialKernels.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+namespace subj {
+
+namespace {
+
+const uint32_t UNREACHED = std::numeric_limits<uint32_t>::max();
+
+// Analysts are evaluated one per thread, each one traverses its whole reachable network
+const size_t VIEW_GRAIN_SIZE = 1;
+
+// Queries are cheap once the views are available
+const size_t QUERY_GRAIN_SIZE = 64;
+
+} // namespace
+
+TrustNetwork::TrustNetwork(const AgentId& agent_count)
+  : m_outgoing(agent_count)
+  , m_incoming(agent_count)
+{
+}
+
+TrustNetwork::AgentId TrustNetwork::addAgent()
+{
+  if (m_outgoing.size() >= static_cast<size_t>(UNREACHED))
+  {
+    throw std::length_error("The trust network cannot hold more agents");
+  }
+  m_outgoing.emplace_back();
+  m_incoming.emplace_back();
+  return static_cast<AgentId>(m_outgoing.size() - 1);
+}
+
+TrustNetwork::AgentId TrustNetwork::agentCount() const
+{
+  return static_cast<AgentId>(m_outgoing.size());
+}
+
+void TrustNetwork::setTrust(const AgentId& truster,
+                            const AgentId& trustee,
+                            const BinomialOpinion& trust)
+{
+  checkAgent(truster);
+  checkAgent(trustee);
+  if (truster == trustee)
+  {
+    throw std::invalid_argument("An agent cannot hold trust in itself");
+  }
+
+  Trust value = {trust.b(), trust.d(), trust.u(), trust.a()};
+
+  std::vector<Edge>& outgoing = m_outgoing[truster];
+  auto out = std::find_if(
+    outgoing.begin(), outgoing.end(), [&](const Edge& edge) { return edge.agent == trustee; });
+  if (out == outgoing.end())
+  {
+    outgoing.push_back({trustee, value});
+    m_incoming[trustee].push_back({truster, value});
+    invalidateViews(truster);
+    return;
+  }
+
+  out->trust = value;
+  std::vector<Edge>& incoming = m_incoming[trustee];
+  auto in = std::find_if(
+    incoming.begin(), incoming.end(), [&](const Edge& edge) { return edge.agent == truster; });
+  in->trust = value;
+
+  for (auto& entry : m_views)
+  {
+    propagateEdgeChange(entry.second, truster, trustee);
+  }
+}
+
+bool TrustNetwork::removeTrust(const AgentId& truster, const AgentId& trustee)
+{
+  checkAgent(truster);
+  checkAgent(trustee);
+
+  std::vector<Edge>& outgoing = m_outgoing[truster];
+  auto out = std::find_if(
+    outgoing.begin(), outgoing.end(), [&](const Edge& edge) { return edge.agent == trustee; });
+  if (out == outgoing.end())
+  {
+    return false;
+  }
+  outgoing.erase(out);
+
+  std::vector<Edge>& incoming = m_incoming[trustee];
+  incoming.erase(std::find_if(
+    incoming.begin(), incoming.end(), [&](const Edge& edge) { return edge.agent == truster; }));
+
+  invalidateViews(truster);
+  return true;
+}
+
+bool TrustNetwork::hasTrust(const AgentId& truster, const AgentId& trustee) const
+{
+  checkAgent(truster);
+  checkAgent(trustee);
+  const std::vector<Edge>& outgoing = m_outgoing[truster];
+  return std::any_of(
+    outgoing.begin(), outgoing.end(), [&](const Edge& edge) { return edge.agent == trustee; });
+}
+
+BinomialOpinion TrustNetwork::trust(const AgentId& truster, const AgentId& trustee) const
+{
+  checkAgent(truster);
+  checkAgent(trustee);
+  for (const Edge& edge : m_outgoing[truster])
+  {
+    if (edge.agent == trustee)
+    {
+      return BinomialOpinion(edge.trust.b, edge.trust.d, edge.trust.u, edge.trust.a);
+    }
+  }
+  throw std::out_of_range("Agent " + std::to_string(truster) + " holds no trust in agent " +
+                          std::to_string(trustee));
+}
+
+void TrustNetwork::setOpinion(const AgentId& agent, const MultinomialOpinion& opinion)
+{
+  checkAgent(agent);
+  auto it = m_opinions.find(agent);
+  if (it == m_opinions.end())
+  {
+    m_opinions.emplace(agent, opinion);
+  }
+  else
+  {
+    it->second = opinion;
+  }
+}
+
+bool TrustNetwork::hasOpinion(const AgentId& agent) const
+{
+  return m_opinions.count(agent) > 0;
+}
+
+BinomialOpinion TrustNetwork::derivedTrust(const AgentId& analyst, const AgentId& agent)
+{
+  checkAgent(agent);
+  const View& v = view(analyst);
+  if (agent == analyst)
+  {
+    return BinomialOpinion(1.0, 0.0, 0.0, 0.5);
+  }
+  if (agent >= v.distance.size() || v.distance[agent] == UNREACHED)
+  {
+    return BinomialOpinion();
+  }
+  const Trust& t = v.trust[agent];
+  return BinomialOpinion(t.b, t.d, t.u, t.a);
+}
+
+MultinomialOpinion TrustNetwork::discountedOpinion(const AgentId& analyst, const AgentId& source)
+{
+  checkAgent(source);
+  auto it = m_opinions.find(source);
+  if (it == m_opinions.end())
+  {
+    throw std::invalid_argument("Agent " + std::to_string(source) + " holds no opinion");
+  }
+  return trustDiscounting(it->second, discountProbability(view(analyst), source));
+}
+
+std::vector<MultinomialOpinion> TrustNetwork::discountedOpinions(const std::vector<Query>& queries)
+{
+  // Create the entries of all missing views first, the map must not rehash while the views are
+  // computed in parallel
+  std::vector<AgentId> analysts;
+  for (const Query& query : queries)
+  {
+    checkAgent(query.first);
+    checkAgent(query.second);
+    if (m_opinions.count(query.second) == 0)
+    {
+      throw std::invalid_argument("Agent " + std::to_string(query.second) + " holds no opinion");
+    }
+    auto it = m_views.find(query.first);
+    if (it == m_views.end())
+    {
+      it = m_views.emplace(query.first, View()).first;
+      it->second.stale = true;
+    }
+    if (it->second.stale)
+    {
+      it->second.stale = false;
+      analysts.push_back(query.first);
+    }
+  }
+
+  std::vector<View*> views;
+  for (const AgentId& analyst : analysts)
+  {
+    views.push_back(&m_views[analyst]);
+  }
+  detail::parallelFor(
+    analysts.size(),
+    [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+      {
+        computeView(analysts[i], *views[i]);
+      }
+    },
+    VIEW_GRAIN_SIZE);
+
+  std::vector<MultinomialOpinion> results(queries.size(), MultinomialOpinion(1));
+  detail::parallelFor(
+    queries.size(),
+    [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+      {
+        const View& v = m_views.find(queries[i].first)->second;
+        results[i]    = trustDiscounting(m_opinions.find(queries[i].second)->second,
+                                      discountProbability(v, queries[i].second));
+      }
+    },
+    QUERY_GRAIN_SIZE);
+  return results;
+}
+
+MultinomialOpinion TrustNetwork::fusedOpinion(const AgentId& analyst,
+                                              const Eigen::Index& dimensions)
+{
+  const View& v = view(analyst);
+  std::vector<MultinomialOpinion> opinions;
+  for (const AgentId& agent : v.order)
+  {
+    auto it = m_opinions.find(agent);
+    if (agent != analyst && it != m_opinions.end())
+    {
+      opinions.push_back(trustDiscounting(it->second, discountProbability(v, agent)));
+    }
+  }
+
+  if (opinions.empty())
+  {
+    return MultinomialOpinion(static_cast<uint32_t>(dimensions));
+  }
+  if (opinions.size() == 1)
+  {
+    return opinions[0];
+  }
+  return aleatoryCumulativeBeliefFusion(opinions);
+}
+
+void TrustNetwork::clearCache()
+{
+  m_views.clear();
+}
+
+void TrustNetwork::checkAgent(const AgentId& agent) const
+{
+  if (agent >= m_outgoing.size())
+  {
+    throw std::out_of_range("Unknown agent " + std::to_string(agent));
+  }
+}
+
+const TrustNetwork::View& TrustNetwork::view(const AgentId& analyst)
+{
+  checkAgent(analyst);
+  auto it = m_views.find(analyst);
+  if (it == m_views.end())
+  {
+    it               = m_views.emplace(analyst, View()).first;
+    it->second.stale = true;
+  }
+  if (it->second.stale)
+  {
+    computeView(analyst, it->second);
+    it->second.stale = false;
+  }
+  return it->second;
+}
+
+void TrustNetwork::computeView(const AgentId& analyst, View& view) const
+{
+  size_t count = m_outgoing.size();
+  view.distance.assign(count, UNREACHED);
+  view.position.assign(count, UNREACHED);
+  view.trust.resize(count);
+  view.order.clear();
+
+  // Breadth-first order, every agent only depends on agents earlier in the order
+  view.distance[analyst] = 0;
+  view.position[analyst] = 0;
+  view.order.push_back(analyst);
+  for (size_t i = 0; i < view.order.size(); ++i)
+  {
+    AgentId agent = view.order[i];
+    if (agent != analyst)
+    {
+      view.trust[agent] = fuseIncoming(view, agent);
+    }
+    for (const Edge& edge : m_outgoing[agent])
+    {
+      if (view.distance[edge.agent] == UNREACHED)
+      {
+        view.distance[edge.agent] = view.distance[agent] + 1;
+        view.position[edge.agent] = static_cast<uint32_t>(view.order.size());
+        view.order.push_back(edge.agent);
+      }
+    }
+  }
+}
+
+TrustNetwork::Trust TrustNetwork::fuseIncoming(const View& view, const AgentId& agent) const
+{
+  uint32_t distance              = view.distance[agent];
+  bool fused                     = false;
+  detail::BinomialValues result = {0.0, 0.0, 1.0, 0.5};
+  for (const Edge& edge : m_incoming[agent])
+  {
+    if (view.distance[edge.agent] + 1 != distance)
+    {
+      continue;
+    }
+
+    detail::BinomialValues path = {edge.trust.b, edge.trust.d, edge.trust.u, edge.trust.a};
+    if (distance > 1)
+    {
+      const Trust& t = view.trust[edge.agent];
+      path = detail::binomialTrustDiscounting(path, t.b + t.a * t.u);
+    }
+    result = fused ? detail::binomialCumulativeFusion(result, path) : path;
+    fused  = true;
+  }
+  return {result.b, result.d, result.u, result.a};
+}
+
+void TrustNetwork::propagateEdgeChange(View& view,
+                                       const AgentId& truster,
+                                       const AgentId& trustee) const
+{
+  if (view.stale || truster >= view.distance.size() || trustee >= view.distance.size() ||
+      view.distance[truster] == UNREACHED || view.distance[trustee] != view.distance[truster] + 1)
+  {
+    // The edge is not part of the shortest trust paths of this analyst
+    return;
+  }
+
+  // Re-evaluate the trustee and everything downstream of it in breadth-first order
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t> > pending;
+  std::vector<bool> queued(view.order.size(), false);
+  pending.push(view.position[trustee]);
+  queued[view.position[trustee]] = true;
+  while (!pending.empty())
+  {
+    AgentId agent = view.order[pending.top()];
+    pending.pop();
+    view.trust[agent] = fuseIncoming(view, agent);
+    for (const Edge& edge : m_outgoing[agent])
+    {
+      uint32_t position = view.position[edge.agent];
+      if (view.distance[edge.agent] == view.distance[agent] + 1 && !queued[position])
+      {
+        queued[position] = true;
+        pending.push(position);
+      }
+    }
+  }
+}
+
+void TrustNetwork::invalidateViews(const AgentId& truster)
+{
+  for (auto& entry : m_views)
+  {
+    View& view = entry.second;
+    if (truster < view.distance.size() && view.distance[truster] != UNREACHED)
+    {
+      view.stale = true;
+    }
+  }
+}
+
+double TrustNetwork::discountProbability(const View& view, const AgentId& source) const
+{
+  if (source == view.order.front())
+  {
+    return 1.0;
+  }
+  if (source >= view.distance.size() || view.distance[source] == UNREACHED)
+  {
+    return 0.0;
+  }
+  const Trust& t = view.trust[source];
+  return t.b + t.a * t.u;
+}
+
+} // namespace subj
@@ -0,0 +1,236 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+//
+// Copyright 2026 FZI Forschungszentrum Informatik
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// “Software”), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!\file
+ *
+ * \author  Stefan Orf <orf@fzi.de>
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+
+
+#include <subj/Workspace.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace subj {
+
+namespace {
+
+// Size of the first heap block of a workspace created without capacity.
+const size_t MINIMUM_BLOCK_SIZE = 4096;
+
+size_t alignUp(size_t value)
+{
+  return (value + Workspace::ALIGNMENT - 1) & ~(Workspace::ALIGNMENT - 1);
+}
+
+char* alignUp(char* pointer)
+{
+  return reinterpret_cast<char*>(alignUp(reinterpret_cast<uintptr_t>(pointer)));
+}
+
+} // namespace
+
+Workspace::Scope::Scope(Workspace& workspace)
+  : m_workspace(workspace)
+  , m_block(workspace.m_block)
+  , m_offset(workspace.m_offset)
+  , m_used(workspace.m_used)
+{
+  ++m_workspace.m_scopes;
+}
+
+Workspace::Scope::~Scope()
+{
+  m_workspace.m_block  = m_block;
+  m_workspace.m_offset = m_offset;
+  m_workspace.m_used   = m_used;
+  --m_workspace.m_scopes;
+}
+
+Workspace::Workspace(size_t capacity)
+  : m_block(0)
+  , m_offset(0)
+  , m_used(0)
+  , m_heap_allocations(0)
+  , m_scopes(0)
+{
+  if (capacity > 0)
+  {
+    addBlock(capacity);
+  }
+}
+
+Workspace::Workspace(void* buffer, size_t size)
+  : m_block(0)
+  , m_offset(0)
+  , m_used(0)
+  , m_heap_allocations(0)
+  , m_scopes(0)
+{
+  char* data    = alignUp(static_cast<char*>(buffer));
+  size_t offset = static_cast<size_t>(data - static_cast<char*>(buffer));
+  Block block   = {nullptr, data, size > offset ? (size - offset) & ~(ALIGNMENT - 1) : 0};
+  m_blocks.push_back(block);
+}
+
+Workspace::~Workspace()
+{
+  for (const Block& block : m_blocks)
+  {
+    delete[] block.memory;
+  }
+}
+
+double* Workspace::allocate(size_t count)
+{
+  // Leaves room for aligning the size and the heap block holding it.
+  if (count > (std::numeric_limits<size_t>::max() - 2 * ALIGNMENT) / sizeof(double))
+  {
+    throw std::bad_alloc();
+  }
+
+  size_t bytes = alignUp(count * sizeof(double));
+  while (m_block < m_blocks.size())
+  {
+    Block& block = m_blocks[m_block];
+    if (bytes <= block.size - m_offset)
+    {
+      double* memory = reinterpret_cast<double*>(block.data + m_offset);
+      m_offset += bytes;
+      m_used += bytes;
+      return memory;
+    }
+    // The rest of the block stays unused until the enclosing scope ends.
+    m_used += block.size - m_offset;
+    ++m_block;
+    m_offset = 0;
+  }
+
+  addBlock(std::max(bytes, std::max(capacity(), MINIMUM_BLOCK_SIZE)));
+  m_block = m_blocks.size() - 1;
+  return allocate(count);
+}
+
+Eigen::Map<Eigen::VectorXd, Eigen::Aligned> Workspace::vector(Eigen::Index size)
+{
+  return Eigen::Map<Eigen::VectorXd, Eigen::Aligned>(allocate(static_cast<size_t>(size)), size);
+}
+
+Eigen::Map<Eigen::MatrixXd, Eigen::Aligned> Workspace::matrix(Eigen::Index rows,
+                                                              Eigen::Index cols)
+{
+  return Eigen::Map<Eigen::MatrixXd, Eigen::Aligned>(
+    allocate(static_cast<size_t>(rows * cols)), rows, cols);
+}
+
+void Workspace::reset()
+{
+  if (m_scopes > 0)
+  {
+    throw std::logic_error("Workspace cannot be reset while a scope is alive!");
+  }
+
+  m_block  = 0;
+  m_offset = 0;
+  m_used   = 0;
+
+  size_t heap_blocks = 0;
+  size_t heap_size   = 0;
+  for (const Block& block : m_blocks)
+  {
+    if (block.memory != nullptr)
+    {
+      ++heap_blocks;
+      heap_size += block.size;
+    }
+  }
+  if (heap_blocks < 2)
+  {
+    return;
+  }
+
+  std::vector<Block> blocks;
+  for (const Block& block : m_blocks)
+  {
+    if (block.memory == nullptr)
+    {
+      blocks.push_back(block);
+    }
+    else
+    {
+      delete[] block.memory;
+    }
+  }
+  m_blocks.swap(blocks);
+  addBlock(heap_size);
+}
+
+size_t Workspace::used() const
+{
+  return m_used;
+}
+
+size_t Workspace::capacity() const
+{
+  size_t size = 0;
+  for (const Block& block : m_blocks)
+  {
+    size += block.size;
+  }
+  return size;
+}
+
+size_t Workspace::heapAllocations() const
+{
+  return m_heap_allocations;
+}
+
+Workspace& Workspace::local()
+{
+  static thread_local Workspace workspace;
+  return workspace;
+}
+
+void Workspace::addBlock(size_t size)
+{
+  size = alignUp(size);
+
+  char* memory = new char[size + ALIGNMENT - 1];
+  Block block  = {memory, alignUp(memory), size};
+  m_blocks.push_back(block);
+  ++m_heap_allocations;
+}
+
+} // namespace subj
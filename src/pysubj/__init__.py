@@ -7,5 +7,6 @@ a subjective logic library written in C++.
 '''
 
 from .pysubj import *
+from . import ufunc
 
-__all__ = ("__doc__", "__version__", "OpinionOwner", "DirichletPDF", "MultinomialOpinion", "BinomialOpinion", "projectedDistance", "pd", "conjunctiveCertainty", "cc", "degreeOfConflict", "doc", "averagingBeliefFusion", "abf", "aleatoryCumulativeBeliefFusion", "cbf", "cumulativeUnfusion", "trustDiscounting", "td")
\ No newline at end of file
+__all__ = ("__doc__", "__version__", "IsaLevel", "supportedIsaLevel", "isaSupported", "isaLevel", "setIsaLevel", "isaName", "Executor", "SerialExecutor", "WorkStealingExecutor", "defaultExecutor", "executor", "setExecutor", "FusionMode", "OpinionOwner", "OwnerRegistry", "OwnerTrust", "DirichletPDF", "MultinomialOpinion", "BinomialOpinion", "DecayingOpinion", "SparseBaseRate", "SparseOpinion", "Histogram", "OpinionBuffer", "toBytes", "fromBytes", "MappedOpinionFile", "writeOpinionFile", "FloatOpinionColumns", "QuantizedOpinions", "EvidenceTable", "ingestEvidence", "ingestEvidenceFile", "evidenceOpinionBatch", "evidenceOpinions", "OpinionGraph", "OpinionIndex", "OpinionStore", "SubjectiveNetwork", "TrustNetwork", "projectedDistance", "pd", "conjunctiveCertainty", "cc", "degreeOfConflict", "doc", "averagingBeliefFusion", "abf", "aleatoryCumulativeBeliefFusion", "cbf", "weightedBeliefFusion", "wbf", "consensusAndCompromiseFusion", "ccf", "beliefConstraintFusion", "bcf", "cumulativeUnfusion", "trustDiscounting", "td", "discountAndFuse", "evidenceDecay", "batchAveragingBeliefFusion", "batchAbf", "batchAleatoryCumulativeBeliefFusion", "batchCbf", "batchWeightedBeliefFusion", "batchWbf", "batchConsensusAndCompromiseFusion", "batchCcf", "batchBeliefConstraintFusion", "batchBcf", "batchDiscountAndFuse", "batchTrustDiscounting", "batchTd", "ownerTrustDiscounting", "batchOwnerTrustDiscounting", "batchProjection", "batchProjectedDistance", "batchPd", "batchDeduction", "ufunc")
\ No newline at end of file
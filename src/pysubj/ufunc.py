@@ -0,0 +1,102 @@
+'''
+pySUBJ ufuncs - Element-wise operators on binomial opinions
+-----------------------------------------------------------
+
+Binomial opinions are given as separate belief (b), disbelief (d),
+uncertainty (u) and base rate (a) arrays, which are broadcast against
+each other like the arguments of numpy ufuncs. All functions accept an
+optional out argument, a single array or a tuple of arrays for operators
+returning opinions, which receives the result without allocating
+temporaries. The computation itself runs in the C++ kernels of SUBJ
+with the GIL released.
+'''
+
+import numpy as np
+
+from .pysubj import _kernels
+
+
+def _apply(kernel, inputs, nout, out):
+    if out is None:
+        out = (None,) * nout
+    elif not isinstance(out, tuple):
+        out = (out,)
+    if len(out) != nout:
+        raise ValueError(f"out must contain {nout} arrays")
+
+    operands = [np.asarray(x) for x in inputs] + list(out)
+    op_flags = [["readonly"]] * len(inputs) + [["writeonly", "allocate", "no_broadcast"]] * nout
+    iterator = np.nditer(operands,
+                         flags=["buffered", "external_loop", "grow_inner", "zerosize_ok"],
+                         op_flags=op_flags,
+                         op_dtypes=[np.float64] * len(operands),
+                         casting="same_kind")
+    with iterator:
+        for chunk in iterator:
+            kernel(*chunk)
+        results = tuple(iterator.operands[len(inputs):])
+
+    return results[0] if nout == 1 else results
+
+
+def averagingBeliefFusion(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the averaging belief fusion of two binomial opinions. Returns (b, d, u, a).'''
+    return _apply(_kernels.averagingBeliefFusion, (b1, d1, u1, a1, b2, d2, u2, a2), 4, out)
+
+
+def abf(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the averaging belief fusion of two binomial opinions. Returns (b, d, u, a).'''
+    return averagingBeliefFusion(b1, d1, u1, a1, b2, d2, u2, a2, out)
+
+
+def aleatoryCumulativeBeliefFusion(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the aleatory cumulative belief fusion of two binomial opinions. Returns (b, d, u, a).'''
+    return _apply(_kernels.aleatoryCumulativeBeliefFusion, (b1, d1, u1, a1, b2, d2, u2, a2), 4, out)
+
+
+def cbf(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the aleatory cumulative belief fusion of two binomial opinions. Returns (b, d, u, a).'''
+    return aleatoryCumulativeBeliefFusion(b1, d1, u1, a1, b2, d2, u2, a2, out)
+
+
+def trustDiscounting(b, d, u, a, discount_probability, out=None):
+    '''Calculates the trust discounted binomial opinion. Returns (b, d, u, a).'''
+    return _apply(_kernels.trustDiscounting, (b, d, u, a, discount_probability), 4, out)
+
+
+def td(b, d, u, a, discount_probability, out=None):
+    '''Calculates the trust discounted binomial opinion. Returns (b, d, u, a).'''
+    return trustDiscounting(b, d, u, a, discount_probability, out)
+
+
+def projection(b, d, u, a, out=None):
+    '''Calculates the projection of binomial opinions.'''
+    return _apply(_kernels.projection, (b, d, u, a), 1, out)
+
+
+def p(b, d, u, a, out=None):
+    '''Calculates the projection of binomial opinions.'''
+    return projection(b, d, u, a, out)
+
+
+def variance(b, d, u, a, out=None):
+    '''Calculates the variance of binomial opinions.'''
+    return _apply(_kernels.variance, (b, d, u, a), 1, out)
+
+
+def var(b, d, u, a, out=None):
+    '''Calculates the variance of binomial opinions.'''
+    return variance(b, d, u, a, out)
+
+
+def degreeOfConflict(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the degree of conflict of two binomial opinions.'''
+    return _apply(_kernels.degreeOfConflict, (b1, d1, u1, a1, b2, d2, u2, a2), 1, out)
+
+
+def doc(b1, d1, u1, a1, b2, d2, u2, a2, out=None):
+    '''Calculates the degree of conflict of two binomial opinions.'''
+    return degreeOfConflict(b1, d1, u1, a1, b2, d2, u2, a2, out)
+
+
+__all__ = ("averagingBeliefFusion", "abf", "aleatoryCumulativeBeliefFusion", "cbf", "trustDiscounting", "td", "projection", "p", "variance", "var", "degreeOfConflict", "doc")